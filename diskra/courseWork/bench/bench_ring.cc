@@ -0,0 +1,228 @@
+// bench/bench_ring.cc
+// * бенчмарки ядра: малые операции по вариантам, большие по длинам операндов,
+// * разбор и печать чисел. Счётчики: items_per_second (оп/с) и allocs/op.
+// JSON для сравнения релизов: --benchmark_format=json или цель bench_ring_json
+#include <benchmark/benchmark.h>
+#include "RingRegistry.h"
+#include "SmallRingArithmetic.h"
+#include "BigRingArithmetic.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef RING_CONFIG
+#define RING_CONFIG "config.yaml"
+#endif
+
+// * --- СЧЁТЧИК ВЫДЕЛЕНИЙ ПАМЯТИ ---
+// глобальный operator new считает каждое выделение в процессе.
+// ! пара malloc/free не встраивается: иначе компилятор видит free()
+// ! на указателе из new и предупреждает -Wmismatched-new-delete
+static std::atomic<long long> g_allocations{0};
+
+__attribute__((noinline)) void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+// замер выделений за цикл бенчмарка -> среднее на одну операцию
+class AllocationScope {
+public:
+    explicit AllocationScope(benchmark::State& state)
+        : state_(state), start_(g_allocations.load(std::memory_order_relaxed)) {}
+    ~AllocationScope() {
+        long long count = g_allocations.load(std::memory_order_relaxed) - start_;
+        state_.counters["allocs/op"] = benchmark::Counter(
+            static_cast<double>(count), benchmark::Counter::kAvgIterations);
+        state_.SetItemsProcessed(state_.iterations());
+    }
+private:
+    benchmark::State& state_;
+    long long start_;
+};
+
+const RingRegistry& registry() {
+    return RingRegistry::instance(RING_CONFIG);
+}
+
+// вариант для больших операций: первый из Z8 (как variant_1 в тестах)
+const FiniteRingRules& bigRules() {
+    return registry().contains("variant_1") ? registry().rules("variant_1")
+                                            : registry().rules(registry().getNames().front());
+}
+
+// случайное число длины len без ведущего нуля, фиксированное зерно
+RingNumber randomNumber(const FiniteRingRules& rules, size_t len, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> digit(0, rules.getSize() - 1);
+    std::vector<uint8_t> digits(len);
+    for (auto& d : digits) {
+        d = static_cast<uint8_t>(digit(gen));
+    }
+    if (digits.back() == 0) {
+        digits.back() = 1;
+    }
+    return RingNumber(rules, digits);
+}
+
+// * --- МАЛАЯ АРИФМЕТИКА (по каждому варианту) ---
+template <char (SmallRingArithmetic::*Op)(char, char) const>
+void BM_SmallOp(benchmark::State& state, const std::string& variant) {
+    const FiniteRingRules& rules = registry().rules(variant);
+    SmallRingArithmetic small(rules);
+    const std::vector<char>& symbols = rules.getOrderedValues();
+    const size_t n = symbols.size();
+
+    size_t i = 0;
+    AllocationScope allocations(state);
+    for (auto _ : state) {
+        char r = (small.*Op)(symbols[i % n], symbols[(i / n) % n]);
+        benchmark::DoNotOptimize(r);
+        ++i;
+    }
+}
+
+void BM_SmallDivide(benchmark::State& state, const std::string& variant) {
+    const FiniteRingRules& rules = registry().rules(variant);
+    SmallRingArithmetic small(rules);
+
+    // делим только на обратимые элементы
+    std::vector<char> units;
+    for (int v = 1; v < rules.getSize(); ++v) {
+        if (rules.getInvTable()[v] != FiniteRingRules::NO_INVERSE) {
+            units.push_back(rules.getValueChar(v));
+        }
+    }
+    const std::vector<char>& symbols = rules.getOrderedValues();
+
+    size_t i = 0;
+    AllocationScope allocations(state);
+    for (auto _ : state) {
+        char r = small.divide(symbols[i % symbols.size()], units[i % units.size()]);
+        benchmark::DoNotOptimize(r);
+        ++i;
+    }
+}
+
+void BM_SmallBatchMul(benchmark::State& state, const std::string& variant) {
+    const FiniteRingRules& rules = registry().rules(variant);
+    SmallRingArithmetic small(rules);
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    std::vector<uint8_t> a(count), b(count), out(count);
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = static_cast<uint8_t>(i % rules.getSize());
+        b[i] = static_cast<uint8_t>((i * 7 + 3) % rules.getSize());
+    }
+
+    {
+        AllocationScope allocations(state);
+        for (auto _ : state) {
+            small.mulMany(a.data(), b.data(), out.data(), count);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+    // элементов, а не вызовов
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetLabel(SmallRingArithmetic::batchKernelName());
+}
+
+// * --- БОЛЬШАЯ АРИФМЕТИКА (по длине операндов) ---
+enum class BigOp { Add, Subtract, Multiply, Divide };
+
+template <BigOp Op>
+void BM_BigOp(benchmark::State& state) {
+    const FiniteRingRules& rules = bigRules();
+    SmallRingArithmetic small(rules);
+    BigRingArithmetic big(rules, small);
+
+    const size_t len = static_cast<size_t>(state.range(0));
+    // делитель вдвое короче делимого, чтобы частное было длинным
+    const size_t len_b = (Op == BigOp::Divide) ? std::max<size_t>(1, len / 2) : len;
+    RingNumber a = randomNumber(rules, len, 1);
+    // оба положительные: сложение складывает модули, вычитание вычитает
+    RingNumber b = randomNumber(rules, len_b, 2);
+
+    AllocationScope allocations(state);
+    for (auto _ : state) {
+        switch (Op) {
+            case BigOp::Add: benchmark::DoNotOptimize(big.add(a, b)); break;
+            case BigOp::Subtract: benchmark::DoNotOptimize(big.subtract(a, b)); break;
+            case BigOp::Multiply: benchmark::DoNotOptimize(big.multiply(a, b)); break;
+            case BigOp::Divide: benchmark::DoNotOptimize(big.divide(a, b)); break;
+        }
+    }
+}
+
+// * --- РАЗБОР И ПЕЧАТЬ ---
+void BM_Parse(benchmark::State& state) {
+    const FiniteRingRules& rules = bigRules();
+    const std::string text = randomNumber(rules, static_cast<size_t>(state.range(0)), 3).toString();
+
+    AllocationScope allocations(state);
+    for (auto _ : state) {
+        RingNumber num(rules, text);
+        benchmark::DoNotOptimize(num);
+    }
+}
+
+void BM_ToString(benchmark::State& state) {
+    const FiniteRingRules& rules = bigRules();
+    RingNumber num = randomNumber(rules, static_cast<size_t>(state.range(0)), 4);
+
+    AllocationScope allocations(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(num.toString());
+    }
+}
+
+// длины операндов: от одной цифры до 10k
+void operandLengths(benchmark::internal::Benchmark* b) {
+    for (int len : {1, 8, 16, 64, 512, 4096, 10000}) {
+        b->Arg(len);
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_BigOp<BigOp::Add>)->Name("BM_BigAdd")->Apply(operandLengths);
+BENCHMARK(BM_BigOp<BigOp::Subtract>)->Name("BM_BigSubtract")->Apply(operandLengths);
+BENCHMARK(BM_BigOp<BigOp::Multiply>)->Name("BM_BigMultiply")->Apply(operandLengths);
+BENCHMARK(BM_BigOp<BigOp::Divide>)->Name("BM_BigDivide")->Apply(operandLengths);
+BENCHMARK(BM_Parse)->Apply(operandLengths);
+BENCHMARK(BM_ToString)->Apply(operandLengths);
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // малые операции регистрируются по списку вариантов из конфига
+    for (const std::string& variant : registry().getNames()) {
+        benchmark::RegisterBenchmark(("BM_SmallAdd/" + variant).c_str(),
+                                     BM_SmallOp<&SmallRingArithmetic::add>, variant);
+        benchmark::RegisterBenchmark(("BM_SmallSubtract/" + variant).c_str(),
+                                     BM_SmallOp<&SmallRingArithmetic::subtract>, variant);
+        benchmark::RegisterBenchmark(("BM_SmallMultiply/" + variant).c_str(),
+                                     BM_SmallOp<&SmallRingArithmetic::multiply>, variant);
+        benchmark::RegisterBenchmark(("BM_SmallDivide/" + variant).c_str(),
+                                     BM_SmallDivide, variant);
+        benchmark::RegisterBenchmark(("BM_SmallBatchMul/" + variant).c_str(),
+                                     BM_SmallBatchMul, variant)->Arg(4096);
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
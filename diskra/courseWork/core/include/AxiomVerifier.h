@@ -0,0 +1,66 @@
+// core/include/AxiomVerifier.h
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "BigRingArithmetic.h"
+#include "WorkStealingPool.h"
+
+// * проверяемые аксиомы (в скобках - число операндов)
+enum class Axiom : uint8_t {
+    AddCommutative,    // a + b = b + a                    (2)
+    MulCommutative,    // a * b = b * a                    (2)
+    AddAssociative,    // (a + b) + c = a + (b + c)        (3)
+    MulAssociative,    // (a * b) * c = a * (b * c)        (3)
+    Distributive,      // a * (b + c) = a * b + a * c      (3)
+    Identities,        // a + 0 = a, a * 1 = a, a - a = 0, -(-a) = a (1)
+    DivisionInvariant  // b != 0: a = b * q + r, 0 <= r < |b| (2)
+};
+
+struct VerifierOptions {
+    size_t max_digits = 2;       // операнды - все числа до k цифр
+    bool with_signs = false;     // и их отрицания
+    unsigned threads = 0;        // 0 - по числу ядер
+    std::vector<Axiom> axioms;   // пусто - все аксиомы
+    // * прогресс: (проверено, всего), вызывается в вызывающем потоке
+    std::function<void(uint64_t, uint64_t)> progress;
+};
+
+struct AxiomReport {
+    Axiom axiom;
+    uint64_t checked = 0;        // проверено наборов операндов
+    uint64_t total = 0;          // N^(k * арность) (с учётом знаков)
+    bool passed = true;
+    // * первый найденный контрпример (если не прошла)
+    std::vector<RingNumber> operands;
+    std::string message;
+};
+
+/*
+ * Полный перебор аксиом над всеми числами до k цифр.
+ * Пространство наборов операндов (|операндов|^арность) режется на
+ * диапазоны и раздаётся пулу с кражей работы; на первом контрпримере
+ * перебор аксиомы останавливается.
+ */
+class AxiomVerifier {
+public:
+    AxiomVerifier(const FiniteRingRules& rules, const BigRingArithmetic& big);
+
+    // * отчёт по каждой аксиоме; проверка прерывается на первой непрошедшей
+    std::vector<AxiomReport> run(const VerifierOptions& options) const;
+
+    static std::string axiomName(Axiom axiom);
+    static int arity(Axiom axiom);
+    static const std::vector<Axiom>& allAxioms();
+
+private:
+    const FiniteRingRules& rules_;
+    const BigRingArithmetic& big_;
+
+    std::vector<RingNumber> operandSpace(const VerifierOptions& options) const;
+    // * пустая строка - аксиома выполнена на этих операндах
+    std::string check(Axiom axiom, const RingNumber* operands) const;
+};
@@ -3,6 +3,9 @@
 #include "SmallRingArithmetic.h"
 #include "RingNumber.h"
 #include "DivisionResult.h"
+#include "GcdResult.h"
+#include "PackedRingNumber.h"
+#include "DigitView.h"
 
 class BigRingArithmetic {
 public:
@@ -18,24 +21,70 @@ public:
     RingNumber negate(const RingNumber& a) const;
     RingNumber subtractPositional(const RingNumber& a, const RingNumber& b) const;
 
+    // * возведение в степень (скользящее окно по битам показателя), 0^0 = 1
+    // ! показатель-число должен быть неотрицательным
+    RingNumber pow(const RingNumber& base, uint64_t exponent) const;
+    RingNumber pow(const RingNumber& base, const RingNumber& exponent) const;
+    // * то же по модулю N^MAX_DIGITS: после каждого умножения остаются
+    // * MAX_DIGITS младших разрядов модуля, знак как у точной степени
+    RingNumber powFixed(const RingNumber& base, uint64_t exponent) const;
+    RingNumber powFixed(const RingNumber& base, const RingNumber& exponent) const;
+
+    // * НОД модулей (алгоритм Лемера), gcd(0, 0) = 0
+    RingNumber gcd(const RingNumber& a, const RingNumber& b) const;
+    // * НОД и коэффициенты Безу: a*x + b*y = gcd, знаки a и b учитываются
+    GcdResult extendedGcd(const RingNumber& a, const RingNumber& b) const;
+    // * обратный к a по модулю |m|, результат в [0, |m|)
+    // ! бросает, если m = 0 или gcd(a, m) != 1
+    RingNumber modInverse(const RingNumber& a, const RingNumber& m) const;
+
+    // * упакованный режим: длина не ограничена, k цифр на 64-битный limb
+    PackedRingNumber add(const PackedRingNumber& a, const PackedRingNumber& b) const;
+    PackedRingNumber subtract(const PackedRingNumber& a, const PackedRingNumber& b) const;
+    PackedRingNumber negate(const PackedRingNumber& a) const;
+    // ! знаковое сравнение: -1 если a < b, 0 если равны, 1 если a > b
+    int compare(const PackedRingNumber& a, const PackedRingNumber& b) const;
+
     // * константа: максимальное количество разрядов
     static const size_t MAX_DIGITS = 8;
 
 private:
     const FiniteRingRules& rules_;
     const SmallRingArithmetic& small_;
-
-    const char zero_ = rules_.getZeroElement();
-    const char one_ = rules_.getOneElement();
     
-    // * вспомогательные методы
-    RingNumber multiplyByDigit(const RingNumber& num, char digit) const;
-    char findQuotientDigit(const RingNumber& remainder, const RingNumber& shifted_divisor) const;
-    RingNumber addUnsigned(const RingNumber& a, const RingNumber& b) const;
-    // * сдвиги
-    RingNumber shiftLeft(const RingNumber& num, int positions) const;
-    RingNumber shiftRight(const RingNumber& num, int positions) const;
+    // * вспомогательные методы над модулями (цифры - индексы 0..N-1);
+    // * окна не копируют операнды, результат - неотрицательное число
+    RingNumber multiplyByDigit(DigitView num, uint8_t digit) const;
+    // * деление модулей (алгоритм D Кнута) и оценка цифры частного
+    void divideMagnitudes(DigitView u, DigitView v,
+                          DigitBuffer& quotient, DigitBuffer& remainder) const;
+    uint32_t estimateQuotientDigit(uint32_t u2, uint32_t u1, uint32_t u0,
+                                   uint32_t v1, uint32_t v0) const;
+    RingNumber addUnsigned(DigitView a, DigitView b) const;
+    // ! требует |a| >= |b|
+    RingNumber subtractUnsigned(DigitView a, DigitView b) const;
+    // * быстрый путь через int64: число до k = floor(log_N 2^63) цифр
+    // * точно переводится в машинное целое и обратно
+    bool fitsNative(const RingNumber& num, size_t max_digits) const {
+        return num.length() <= max_digits;
+    }
+    int64_t toNative(const RingNumber& num) const;
+    RingNumber fromNative(int64_t value) const;
     // * сравнение 
-    bool isGreaterOrEqual(const RingNumber& a, const RingNumber& b) const;
-    bool isLessThan(char a, char b) const;
+    bool isGreaterOrEqual(DigitView a, DigitView b) const;
+    bool isLessThan(uint8_t a, uint8_t b) const;
+    // * операции над модулями в limb'ах (основание N^k)
+    std::vector<uint64_t> addLimbs(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) const;
+    std::vector<uint64_t> subtractLimbs(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) const;
+    int compareLimbs(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) const;
+    // * степень по битам показателя (старший первым); keep_digits = 0 - без обрезки
+    RingNumber powBits(const RingNumber& base, const std::vector<uint8_t>& bits, size_t keep_digits) const;
+    std::vector<uint8_t> exponentBits(const RingNumber& exponent) const;
+    std::vector<uint8_t> exponentBits(uint64_t exponent) const;
+    RingNumber truncate(const RingNumber& num, size_t digits) const;
+    // * Евклид над модулями |a| >= |b|; cofactor != nullptr - ведётся
+    // * коэффициент при исходном a (второй восстанавливается делением)
+    RingNumber lehmerGcd(RingNumber a, RingNumber b, RingNumber* cofactor) const;
+    // * старшие цифры модуля выше позиции shift как машинное целое
+    int64_t leadingNative(DigitView num, size_t shift) const;
 };
\ No newline at end of file
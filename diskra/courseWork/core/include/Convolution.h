@@ -0,0 +1,23 @@
+// core/include/Convolution.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Свёртка последовательностей коэффициентов без переносов:
+ * out[k] = sum(a[i] * b[k - i]), длина результата na + nb - 1.
+ *
+ * Ниже порога - школьное умножение, выше - вычитательная Карацуба
+ * (z1 = z0 + z2 - (a0 - a1)(b0 - b1)). Переносы по основанию N
+ * делает вызывающая сторона (BigRingArithmetic, RingPolynomial).
+ *
+ * ! Разности берутся от разностей прошлого уровня, поэтому на глубине d
+ * ! вход до ±2^d·(N-1), а коэффициенты листа - до len·(2^d·(N-1))^2.
+ * ! С порогом 32 это не больше n^2·(N-1)^2 / 8 для короткого операнда
+ * ! длины n: int64_t точен при n·(N-1) < 2^33 (для Z11 - до ~8.5·10^8 цифр).
+ */
+
+// * порог перехода на Карацубу (по длине короткого операнда)
+const size_t KARATSUBA_THRESHOLD = 32;
+
+void convolve(const int64_t* a, size_t na, const int64_t* b, size_t nb, int64_t* out);
@@ -0,0 +1,144 @@
+// core/include/DigitBuffer.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <initializer_list>
+
+/*
+ * Буфер индексов цифр с малым встроенным хранилищем.
+ * До INLINE_CAPACITY цифр данные лежат внутри объекта и куча не трогается,
+ * длиннее - переезжают в динамический массив. Перемещение длинного буфера
+ * забирает указатель, короткого - копирует 16 байт.
+ */
+class DigitBuffer {
+public:
+    static constexpr size_t INLINE_CAPACITY = 16;
+
+    DigitBuffer() noexcept : data_(inline_), size_(0), capacity_(INLINE_CAPACITY) {}
+    explicit DigitBuffer(size_t count) : DigitBuffer() { assign(count, 0); }
+    DigitBuffer(size_t count, uint8_t value) : DigitBuffer() { assign(count, value); }
+    DigitBuffer(const uint8_t* first, size_t count) : DigitBuffer() { assign(first, count); }
+    DigitBuffer(std::initializer_list<uint8_t> values) : DigitBuffer() {
+        assign(values.begin(), values.size());
+    }
+
+    DigitBuffer(const DigitBuffer& other) : DigitBuffer() { assign(other.data_, other.size_); }
+    DigitBuffer(DigitBuffer&& other) noexcept : DigitBuffer() { steal(other); }
+
+    DigitBuffer& operator=(const DigitBuffer& other) {
+        if (this != &other) {
+            assign(other.data_, other.size_);
+        }
+        return *this;
+    }
+    DigitBuffer& operator=(DigitBuffer&& other) noexcept {
+        if (this != &other) {
+            release();
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~DigitBuffer() { release(); }
+
+    // * доступ
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return capacity_; }
+    bool isInline() const { return data_ == inline_; }
+
+    uint8_t* data() { return data_; }
+    const uint8_t* data() const { return data_; }
+    uint8_t& operator[](size_t index) { return data_[index]; }
+    uint8_t operator[](size_t index) const { return data_[index]; }
+    uint8_t& back() { return data_[size_ - 1]; }
+    uint8_t back() const { return data_[size_ - 1]; }
+
+    uint8_t* begin() { return data_; }
+    uint8_t* end() { return data_ + size_; }
+    const uint8_t* begin() const { return data_; }
+    const uint8_t* end() const { return data_ + size_; }
+
+    // * изменение
+    void reserve(size_t count) {
+        if (count > capacity_) {
+            grow(count);
+        }
+    }
+    void push_back(uint8_t value) {
+        if (size_ == capacity_) {
+            grow(size_ + 1);
+        }
+        data_[size_++] = value;
+    }
+    void pop_back() { --size_; }
+    void clear() { size_ = 0; }
+
+    // ! новые ячейки заполняются value, старые сохраняются
+    void resize(size_t count, uint8_t value = 0) {
+        reserve(count);
+        if (count > size_) {
+            std::memset(data_ + size_, value, count - size_);
+        }
+        size_ = count;
+    }
+    void assign(size_t count, uint8_t value) {
+        size_ = 0;
+        resize(count, value);
+    }
+    void assign(const uint8_t* first, size_t count) {
+        size_ = 0;
+        reserve(count);
+        if (count != 0) {
+            std::memcpy(data_, first, count);
+        }
+        size_ = count;
+    }
+
+    bool operator==(const DigitBuffer& other) const {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+    bool operator!=(const DigitBuffer& other) const { return !(*this == other); }
+
+private:
+    uint8_t* data_;
+    size_t size_;
+    size_t capacity_;
+    uint8_t inline_[INLINE_CAPACITY];
+
+    // ! ёмкость растёт минимум вдвое, чтобы push_back оставался амортизированно O(1)
+    void grow(size_t count) {
+        const size_t new_capacity = std::max(count, 2 * capacity_);
+        uint8_t* heap = new uint8_t[new_capacity];
+        std::copy(data_, data_ + size_, heap);
+        release();
+        data_ = heap;
+        capacity_ = new_capacity;
+    }
+
+    void release() {
+        if (!isInline()) {
+            delete[] data_;
+            data_ = inline_;
+            capacity_ = INLINE_CAPACITY;
+        }
+    }
+
+    // * забрать содержимое other, оставив его пустым встроенным буфером
+    void steal(DigitBuffer& other) noexcept {
+        if (other.isInline()) {
+            std::memcpy(inline_, other.inline_, other.size_);
+            data_ = inline_;
+            capacity_ = INLINE_CAPACITY;
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_;
+            other.capacity_ = INLINE_CAPACITY;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+};
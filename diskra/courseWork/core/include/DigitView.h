@@ -0,0 +1,77 @@
+// core/include/DigitView.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include "DigitBuffer.h"
+
+/*
+ * Невладеющее окно над цифрами числа: указатель + длина, младший разряд первым.
+ * Окно живёт не дольше буфера, над которым построено. Отбрасывание младших
+ * разрядов (деление на N^k) и ведущих нулей - O(1), без копирования.
+ */
+class DigitView {
+public:
+    DigitView() : data_(nullptr), length_(0) {}
+    DigitView(const uint8_t* data, size_t length) : data_(data), length_(length) {}
+    DigitView(const DigitBuffer& digits) : data_(digits.data()), length_(digits.size()) {}
+
+    // * доступ
+    size_t length() const { return length_; }
+    bool empty() const { return length_ == 0; }
+    const uint8_t* data() const { return data_; }
+    const uint8_t* begin() const { return data_; }
+    const uint8_t* end() const { return data_ + length_; }
+    uint8_t operator[](size_t index) const { return data_[index]; }
+    // ! за пределами окна = 0
+    uint8_t digitAt(size_t index) const { return index < length_ ? data_[index] : 0; }
+
+    // * окно [offset, offset + length), обрезается по границе числа
+    DigitView window(size_t offset, size_t length) const {
+        if (offset >= length_) {
+            return DigitView(data_ + length_, 0);
+        }
+        return DigitView(data_ + offset, std::min(length, length_ - offset));
+    }
+    // * без младших count разрядов: целая часть от деления на N^count
+    DigitView dropLow(size_t count) const { return window(count, length_); }
+
+    // * без ведущих нулей (ноль остаётся одной цифрой)
+    DigitView trimmed() const {
+        size_t len = length_;
+        while (len > 1 && data_[len - 1] == 0) {
+            --len;
+        }
+        return DigitView(data_, len);
+    }
+
+    bool isZero() const {
+        for (size_t i = 0; i < length_; ++i) {
+            if (data_[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // * сравнение модулей: -1, 0, 1 (ведущие нули не учитываются)
+    static int compare(DigitView a, DigitView b) {
+        size_t len_a = a.length_;
+        size_t len_b = b.length_;
+        while (len_a > 0 && a.data_[len_a - 1] == 0) --len_a;
+        while (len_b > 0 && b.data_[len_b - 1] == 0) --len_b;
+        if (len_a != len_b) {
+            return len_a > len_b ? 1 : -1;
+        }
+        for (size_t i = len_a; i > 0; --i) {
+            if (a.data_[i - 1] != b.data_[i - 1]) {
+                return a.data_[i - 1] > b.data_[i - 1] ? 1 : -1;
+            }
+        }
+        return 0;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t length_;
+};
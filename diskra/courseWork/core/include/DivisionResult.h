@@ -3,6 +3,7 @@
 
 #include "RingNumber.h"
 #include <sstream>
+#include <utility>
 
 // * структура для возврата результата деления
 struct DivisionResult {
@@ -10,8 +11,8 @@ struct DivisionResult {
     RingNumber remainder; // остаток (R)
     
     // ! конструктор для удобного возврата из divide
-    DivisionResult(const RingNumber& q, const RingNumber& r) 
-        : quotient(q), remainder(r) {}
+    DivisionResult(RingNumber q, RingNumber r) 
+        : quotient(std::move(q)), remainder(std::move(r)) {}
 
     std::string toString() const {
         std::stringstream ss;
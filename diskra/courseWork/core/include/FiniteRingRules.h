@@ -1,13 +1,16 @@
 #pragma once
 #include <string>
 #include <vector>
-#include <map>
+#include <array>
+#include <cstdint>
 #include "yaml-cpp/yaml.h"
 
 class FiniteRingRules {
 public:
     // * конструктор из файла конфигурации и имени варианта
     FiniteRingRules(const std::string& config_file, const std::string& variant_name);
+    // * из уже разобранного узла варианта (без повторного чтения файла)
+    explicit FiniteRingRules(const YAML::Node& variant_node);
 
     // * свойства поля
     int  getSize() const { return size_; }
@@ -16,20 +19,65 @@ public:
 
     // * преобразования между символами и значениями (индексами)
     char getValueChar(int v) const { return values_.at(v % size_); }
-    int  getCharValue(char c) const;
+    int  getCharValue(char c) const {
+        int v = lookupIndex(c);
+        if (v == INVALID_INDEX) {
+            throwInvalidChar(c);
+        }
+        return v;
+    }
+
+    // * индекс символа без исключений: INVALID_INDEX для чужих символов
+    int  lookupIndex(char c) const { return char_to_val_[static_cast<unsigned char>(c)]; }
+    const std::array<int16_t, 256>& getIndexTable() const { return char_to_val_; }
 
     // * проверка валидности символа
-    bool isValidChar(char c) const;
+    bool isValidChar(char c) const { return lookupIndex(c) != INVALID_INDEX; }
 
     void printRules() const;
     const std::vector<char>& getOrderedValues() const;
+
+    // * таблицы Кэли по индексам (строятся один раз при загрузке правил)
+    // ! ячейка [a * size + b] хранит индекс результата a (op) b
+    const std::vector<uint8_t>& getAddTable() const { return add_table_; }
+    const std::vector<uint8_t>& getSubTable() const { return sub_table_; }
+    const std::vector<uint8_t>& getMulTable() const { return mul_table_; }
+    // * обратные элементы по индексу; NO_INVERSE если обратного нет
+    const std::vector<uint8_t>& getNegTable() const { return neg_table_; }
+    const std::vector<uint8_t>& getInvTable() const { return inv_table_; }
+
+    // * таблицы позиционного сложения/вычитания с переносом
+    // ! ячейка [(c * size + a) * size + b] = цифра | (перенос << 8),
+    // ! для сложения a + b + c, для вычитания a - b - c (перенос = заём)
+    const std::vector<uint16_t>& getCarryTable() const { return carry_table_; }
+    const std::vector<uint16_t>& getBorrowTable() const { return borrow_table_; }
+
+    // * упаковка цифр в 64-битные limb'ы: k = floor(log_N 2^63), основание N^k
+    int      getDigitsPerLimb() const { return digits_per_limb_; }
+    uint64_t getLimbBase() const { return limb_base_; }
+
+    static constexpr uint8_t NO_INVERSE = 0xFF;
+    static constexpr int16_t INVALID_INDEX = -1;
     
 private:
     void init(const YAML::Node& variant_node);
+    void buildTables();
+    [[noreturn]] static void throwInvalidChar(char c);
 
     int size_;                              // размер поля
     char zero_;                             // нейтральный по сложению
     char one_;                              // нейтральный по умножению
     std::vector<char> values_;              // цикл элементов от zero_
-    std::map<char,int> char_to_val_;        // символ → индекс 
+    std::array<int16_t, 256> char_to_val_;  // символ → индекс (по коду байта)
+
+    std::vector<uint8_t> add_table_;        // N×N: a + b
+    std::vector<uint8_t> sub_table_;        // N×N: a - b
+    std::vector<uint8_t> mul_table_;        // N×N: a * b
+    std::vector<uint8_t> neg_table_;        // N: -a
+    std::vector<uint8_t> inv_table_;        // N: a^-1
+    std::vector<uint16_t> carry_table_;     // 2×N×N: a + b + c
+    std::vector<uint16_t> borrow_table_;    // 2×N×N: a - b - c
+
+    int digits_per_limb_ = 0;               // k цифр в одном limb
+    uint64_t limb_base_ = 1;                // N^k <= 2^63
 };
@@ -0,0 +1,210 @@
+// core/include/FixedRingNumber.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "FiniteRingRules.h"
+#include "RingNumber.h"
+
+namespace fixed_detail {
+
+// бит на цифру 0..max
+constexpr unsigned bitsFor(unsigned max) {
+    unsigned bits = 0;
+    while ((1u << bits) <= max) {
+        ++bits;
+    }
+    return bits;
+}
+
+// одно и то же поле во всех count позициях
+template <typename Word>
+constexpr Word repeat(Word field, size_t count, unsigned width) {
+    Word word = 0;
+    for (size_t i = 0; i < count; ++i) {
+        word |= field << (i * width);
+    }
+    return word;
+}
+
+}  // namespace fixed_detail
+
+/*
+ * Число фиксированной ширины в одном машинном слове.
+ *
+ * Ring - описатель кольца из сгенерированного RingVariants.h (нужен только
+ * размер N на этапе компиляции, символы - для toString). Digits - число
+ * разрядов модуля, по умолчанию 8 (как BigRingArithmetic::MAX_DIGITS).
+ *
+ * Раскладка: Digits + 1 полей по w = ceil(log2 N) бит, младший разряд в
+ * младших битах; верхнее поле - разряд знака. Отрицательные числа хранятся
+ * в дополнении до N^(Digits+1), число отрицательно, если старшая цифра
+ * >= ceil(N/2). Так помещается любое число до Digits цифр со знаком,
+ * и перевод в RingNumber и обратно без потерь; арифметика идёт по модулю
+ * N^(Digits+1) (переполнение заворачивается).
+ *
+ * Сложение - одно сложение слов со смещением 2^w - N в каждом поле:
+ * поле переполняется ровно когда сумма цифр >= N, перенос уходит в
+ * следующее поле сам; у полей без переноса смещение вычитается обратно.
+ * Вычитание и сравнение сводятся к тому же, без ветвлений.
+ */
+template <class Ring, size_t Digits = 8>
+class FixedRingNumber {
+public:
+    static constexpr int SIZE = Ring::size;
+    static constexpr size_t DIGITS = Digits;
+    static constexpr size_t FIELDS = Digits + 1;
+    static constexpr unsigned WIDTH = fixed_detail::bitsFor(SIZE - 1);
+
+    static_assert(SIZE >= 2 && SIZE <= 255, "Ring size must be in range [2, 255]");
+    static_assert(Digits >= 1, "At least one digit required");
+    // + бит переноса над старшим полем
+    static_assert(FIELDS * WIDTH < 64, "Digits do not fit in a 64-bit word");
+
+    using Word = std::conditional_t<(FIELDS * WIDTH < 32), uint32_t, uint64_t>;
+
+    constexpr FixedRingNumber() = default;
+
+    // * --- ПРЕОБРАЗОВАНИЯ ---
+    static constexpr FixedRingNumber fromBits(Word bits) { return FixedRingNumber(bits & FIELD_MASK); }
+    constexpr Word bits() const { return bits_; }
+
+    // ! бросает, если |value| не помещается в Digits цифр
+    static constexpr FixedRingNumber fromInteger(int64_t value) {
+        const bool negative = value < 0;
+        uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        Word bits = 0;
+        for (size_t i = 0; i < Digits; ++i) {
+            bits |= static_cast<Word>(magnitude % SIZE) << (i * WIDTH);
+            magnitude /= SIZE;
+        }
+        if (magnitude != 0) {
+            throw std::runtime_error("Number does not fit in " + std::to_string(Digits) + " digits");
+        }
+        FixedRingNumber result(bits);
+        return negative ? -result : result;
+    }
+
+    constexpr int64_t toInteger() const {
+        const FixedRingNumber magnitude = isNegative() ? -*this : *this;
+        int64_t value = 0;
+        for (size_t i = FIELDS; i > 0; --i) {
+            value = value * SIZE + magnitude.digit(i - 1);
+        }
+        return isNegative() ? -value : value;
+    }
+
+    // ! бросает, если число длиннее Digits цифр
+    static FixedRingNumber fromRingNumber(const RingNumber& num) {
+        if (num.getRules().getSize() != SIZE) {
+            throw std::runtime_error("Ring size mismatch: expected " + std::to_string(SIZE) +
+                                     ", got " + std::to_string(num.getRules().getSize()));
+        }
+        const DigitBuffer& digits = num.getValues();
+        size_t length = digits.size();
+        while (length > 0 && digits[length - 1] == 0) {
+            --length;
+        }
+        if (length > Digits) {
+            throw std::runtime_error("Number does not fit in " + std::to_string(Digits) + " digits");
+        }
+        Word bits = 0;
+        for (size_t i = 0; i < length; ++i) {
+            bits |= static_cast<Word>(digits[i]) << (i * WIDTH);
+        }
+        FixedRingNumber result(bits);
+        return num.isNegative() ? -result : result;
+    }
+
+    // * число с модулем не длиннее Digits + 1 цифр (после переполнения)
+    RingNumber toRingNumber(const FiniteRingRules& rules) const {
+        if (rules.getSize() != SIZE) {
+            throw std::runtime_error("Ring size mismatch: expected " + std::to_string(SIZE) +
+                                     ", got " + std::to_string(rules.getSize()));
+        }
+        const FixedRingNumber magnitude = isNegative() ? -*this : *this;
+        DigitBuffer digits(FIELDS);
+        for (size_t i = 0; i < FIELDS; ++i) {
+            digits[i] = magnitude.digit(i);
+        }
+        RingNumber result(rules, std::move(digits), isNegative());
+        result.normalize();
+        return result;
+    }
+
+    std::string toString() const {
+        const FixedRingNumber magnitude = isNegative() ? -*this : *this;
+        size_t length = FIELDS;
+        while (length > 1 && magnitude.digit(length - 1) == 0) {
+            --length;
+        }
+        std::string result = isNegative() ? "-" : "";
+        for (size_t i = length; i > 0; --i) {
+            result.push_back(Ring::symbols[magnitude.digit(i - 1)]);
+        }
+        return result;
+    }
+
+    // * --- ДОСТУП ---
+    // * индекс цифры (0..N-1), i = Digits - разряд знака
+    constexpr uint8_t digit(size_t i) const {
+        return static_cast<uint8_t>((bits_ >> (i * WIDTH)) & DIGIT_MASK);
+    }
+    constexpr bool isZero() const { return bits_ == 0; }
+    constexpr bool isNegative() const { return digit(Digits) >= NEGATIVE_DIGIT; }
+
+    // * --- АРИФМЕТИКА (по модулю N^(Digits+1), без ветвлений) ---
+    friend constexpr FixedRingNumber operator+(FixedRingNumber a, FixedRingNumber b) {
+        return FixedRingNumber(addBits(a.bits_, b.bits_));
+    }
+    // дополнение: (N-1 - d) в каждом поле, затем + 1
+    friend constexpr FixedRingNumber operator-(FixedRingNumber a) {
+        return FixedRingNumber(addBits(ALL_MAX - a.bits_, 1));
+    }
+    friend constexpr FixedRingNumber operator-(FixedRingNumber a, FixedRingNumber b) {
+        return a + (-b);
+    }
+
+    // * --- СРАВНЕНИЕ ---
+    // ! знаковое: -1 если a < b, 0 если равны, 1 если a > b
+    // поворот старшей цифры переводит самое отрицательное число в 0,
+    // после чего порядок слов совпадает с порядком чисел
+    static constexpr int compare(FixedRingNumber a, FixedRingNumber b) {
+        const Word ka = addBits(a.bits_, ORDER_SHIFT);
+        const Word kb = addBits(b.bits_, ORDER_SHIFT);
+        return (ka > kb) - (ka < kb);
+    }
+    friend constexpr bool operator==(FixedRingNumber a, FixedRingNumber b) { return a.bits_ == b.bits_; }
+    friend constexpr bool operator!=(FixedRingNumber a, FixedRingNumber b) { return a.bits_ != b.bits_; }
+    friend constexpr bool operator<(FixedRingNumber a, FixedRingNumber b) { return compare(a, b) < 0; }
+    friend constexpr bool operator<=(FixedRingNumber a, FixedRingNumber b) { return compare(a, b) <= 0; }
+    friend constexpr bool operator>(FixedRingNumber a, FixedRingNumber b) { return compare(a, b) > 0; }
+    friend constexpr bool operator>=(FixedRingNumber a, FixedRingNumber b) { return compare(a, b) >= 0; }
+
+private:
+    // * константы раскладки (по полю на разряд)
+    static constexpr Word DIGIT_MASK = (Word(1) << WIDTH) - 1;
+    static constexpr Word FIELD_MASK = fixed_detail::repeat<Word>(DIGIT_MASK, FIELDS, WIDTH);
+    static constexpr Word BIAS_DIGIT = (Word(1) << WIDTH) - SIZE;
+    static constexpr Word BIAS = fixed_detail::repeat<Word>(BIAS_DIGIT, FIELDS, WIDTH);
+    static constexpr Word ALL_MAX = fixed_detail::repeat<Word>(SIZE - 1, FIELDS, WIDTH);
+    // бит над каждым полем: сюда приходит перенос из поля
+    static constexpr Word CARRY_MASK = fixed_detail::repeat<Word>(1, FIELDS, WIDTH) << WIDTH;
+    static constexpr uint8_t NEGATIVE_DIGIT = (SIZE + 1) / 2;
+    static constexpr Word ORDER_SHIFT = Word(SIZE - NEGATIVE_DIGIT) << (Digits * WIDTH);
+
+    // поразрядное сложение цифр с переносом, старший перенос отбрасывается
+    static constexpr Word addBits(Word x, Word y) {
+        const Word biased = y + BIAS;
+        const Word sum = x + biased;
+        const Word carries = (sum ^ x ^ biased) & CARRY_MASK;
+        const Word uncarried = (~carries & CARRY_MASK) >> WIDTH;
+        return (sum - uncarried * BIAS_DIGIT) & FIELD_MASK;
+    }
+
+    constexpr explicit FixedRingNumber(Word bits) : bits_(bits) {}
+
+    Word bits_ = 0;
+};
@@ -0,0 +1,24 @@
+// core/include/GcdResult.h
+#pragma once
+
+#include "RingNumber.h"
+#include <sstream>
+#include <utility>
+
+// * результат расширенного алгоритма Евклида: a*x + b*y = gcd
+struct GcdResult {
+    RingNumber gcd; // НОД, всегда неотрицательный
+    RingNumber x;   // коэффициент при a
+    RingNumber y;   // коэффициент при b
+
+    GcdResult(RingNumber g, RingNumber x_coef, RingNumber y_coef)
+        : gcd(std::move(g)), x(std::move(x_coef)), y(std::move(y_coef)) {}
+
+    std::string toString() const {
+        std::stringstream ss;
+        ss << "G: " << gcd.toString()
+           << " | X: " << x.toString()
+           << " | Y: " << y.toString();
+        return ss.str();
+    }
+};
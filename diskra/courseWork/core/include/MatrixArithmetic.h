@@ -0,0 +1,72 @@
+// core/include/MatrixArithmetic.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "RingMatrix.h"
+#include "WorkStealingPool.h"
+
+// * результат приведения к ступенчатому виду
+struct EchelonResult {
+    size_t rank;
+    uint8_t determinant;  // индекс; 0, если ранг меньше числа строк
+};
+
+/*
+ * Линейная алгебра над вариантом (семантика SmallRingArithmetic,
+ * индексы - вычеты по модулю N).
+ *
+ * Умножение идёт блоками строк × k × столбцов: блок B остаётся в кэше,
+ * пока по нему проходят строки блока A, суммы копятся в uint32 и
+ * приводятся по N один раз в конце ((N-1)^2 * k не переполняется).
+ * Блоки строк результата раздаются пулу потоков.
+ *
+ * Исключение Гаусса: на каждом шаге строки ниже (и выше - для
+ * приведённого вида) обновляются параллельно, row -= f * pivot.
+ * Для N <= 16 обновление считается без таблиц: x = row + (N - f) * pivot
+ * не больше 240, деление на N - умножение и сдвиг, цикл векторизуется.
+ * Ведущий элемент должен быть обратим, поэтому исключение - только над
+ * полем (варианты Z11); умножение работает над любым вариантом.
+ */
+class MatrixArithmetic {
+public:
+    // ! threads = 0 - по числу ядер
+    explicit MatrixArithmetic(const SmallRingArithmetic& small, unsigned threads = 0);
+    ~MatrixArithmetic();
+
+    RingMatrix add(const RingMatrix& a, const RingMatrix& b) const;
+    RingMatrix subtract(const RingMatrix& a, const RingMatrix& b) const;
+    RingMatrix multiply(const RingMatrix& a, const RingMatrix& b) const;
+    RingMatrix transpose(const RingMatrix& a) const;
+
+    // * приведённый ступенчатый вид (Гаусс-Жордан)
+    // ! исключение бросает, если кольцо - не поле
+    RingMatrix rowEchelon(const RingMatrix& a) const;
+    size_t rank(const RingMatrix& a) const;
+    uint8_t determinant(const RingMatrix& a) const;
+    // ! бросает, если матрица вырождена
+    RingMatrix inverse(const RingMatrix& a) const;
+    // * решение A * X = B для квадратной невырожденной A
+    RingMatrix solve(const RingMatrix& a, const RingMatrix& b) const;
+
+    bool isField() const;
+    const FiniteRingRules& getRules() const { return rules_; }
+
+private:
+    const FiniteRingRules& rules_;
+    const SmallRingArithmetic& small_;
+    std::unique_ptr<WorkStealingPool> pool_;
+    uint32_t reciprocal_;  // ceil(4096 / N) для приведения без деления
+
+    // * прямой ход по первым pivot_cols столбцам, reduced - обнуление и выше
+    EchelonResult eliminate(RingMatrix& m, size_t pivot_cols, bool reduced) const;
+    // row[0..count) -= factor * pivot[0..count)
+    void subtractRow(uint8_t* row, const uint8_t* pivot, uint8_t factor, size_t count) const;
+    void scaleRow(uint8_t* row, uint8_t factor, size_t count) const;
+    // * [a | b] для решения систем и обращения
+    RingMatrix augment(const RingMatrix& a, const RingMatrix& b) const;
+    void requireField() const;
+    void checkRules(const RingMatrix& a) const;
+};
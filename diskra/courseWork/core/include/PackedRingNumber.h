@@ -0,0 +1,52 @@
+// core/include/PackedRingNumber.h
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "FiniteRingRules.h"
+#include "RingNumber.h"
+
+/*
+ * Число в конечном кольце без ограничения длины в упакованном виде.
+ * Каждый 64-битный limb хранит k = floor(log_N 2^63) цифр основания N,
+ * то есть значение limb'а лежит в [0, N^k). Младший limb первым.
+ *
+ * Перевод в RingNumber и обратно нужен только на границе ввода/вывода,
+ * сложение, вычитание и сравнение идут по limb'ам с машинными переносами
+ * (см. BigRingArithmetic::add/subtract/compare для PackedRingNumber).
+ */
+class PackedRingNumber {
+public:
+    // * конструкторы
+    explicit PackedRingNumber(const FiniteRingRules& rules);   // ноль
+    explicit PackedRingNumber(const RingNumber& num);          // упаковка
+    PackedRingNumber(const FiniteRingRules& rules, std::vector<uint64_t> limbs, bool is_negative = false);
+
+    // * распаковка обратно в цифры
+    RingNumber toRingNumber() const;
+    std::string toString() const { return toRingNumber().toString(); }
+
+    // * доступ к limb'ам (младший = индекс 0)
+    size_t limbCount() const { return limbs_.size(); }
+    uint64_t getLimb(size_t index) const {
+        return index < limbs_.size() ? limbs_[index] : 0;
+    }
+    const std::vector<uint64_t>& getLimbs() const { return limbs_; }
+
+    // * проверки
+    bool isZero() const { return limbs_.size() == 1 && limbs_[0] == 0; }
+    bool isNegative() const { return is_negative_; }
+    void setNegative(bool value) { is_negative_ = value && !isZero(); }
+
+    bool operator==(const PackedRingNumber& other) const;
+    bool operator!=(const PackedRingNumber& other) const { return !(*this == other); }
+
+    const FiniteRingRules& getRules() const { return *rules_; }
+
+private:
+    const FiniteRingRules* rules_;
+    std::vector<uint64_t> limbs_;
+    bool is_negative_ = false;
+
+    void normalize();  // удаляет нулевые старшие limb'ы
+};
@@ -0,0 +1,56 @@
+// core/include/PolynomialArithmetic.h
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "RingPolynomial.h"
+
+/*
+ * Арифметика многочленов над вариантом.
+ *
+ * Коэффициенты складываются и умножаются по таблицам Кэли
+ * (SmallRingArithmetic): сложение и вычитание - пакетными ядрами,
+ * школьное умножение и деление - строкой таблицы умножения на
+ * фиксированный множитель. Начиная с KARATSUBA_THRESHOLD коэффициентов
+ * умножение идёт через convolve (Карацуба) в int64 с одним приведением
+ * по модулю N в конце: индексы - это вычеты 0..N-1.
+ *
+ * Деление требует обратимого старшего коэффициента делителя,
+ * НОД - поля (простое N, например варианты Z11).
+ */
+class PolynomialArithmetic {
+public:
+    explicit PolynomialArithmetic(const SmallRingArithmetic& small)
+        : rules_(small.getRules()), small_(small) {}
+
+    RingPolynomial add(const RingPolynomial& a, const RingPolynomial& b) const;
+    RingPolynomial subtract(const RingPolynomial& a, const RingPolynomial& b) const;
+    RingPolynomial negate(const RingPolynomial& a) const;
+    RingPolynomial multiply(const RingPolynomial& a, const RingPolynomial& b) const;
+    // * умножение на коэффициент (индекс)
+    RingPolynomial scale(const RingPolynomial& a, uint8_t factor) const;
+
+    // ! бросает при делении на ноль и необратимом старшем коэффициенте b
+    PolynomialDivisionResult divide(const RingPolynomial& a, const RingPolynomial& b) const;
+    // * нормированный НОД, gcd(0, 0) = 0
+    // ! бросает, если кольцо - не поле
+    RingPolynomial gcd(const RingPolynomial& a, const RingPolynomial& b) const;
+    // * делит на старший коэффициент
+    RingPolynomial monic(const RingPolynomial& a) const;
+    // * значение в точке (схема Горнера), x и результат - индексы
+    uint8_t evaluate(const RingPolynomial& a, uint8_t x) const;
+
+    // * все ненулевые элементы обратимы
+    bool isField() const;
+    const FiniteRingRules& getRules() const { return rules_; }
+
+private:
+    const FiniteRingRules& rules_;
+    const SmallRingArithmetic& small_;
+
+    // out[i] -= factor * b[i] по строке таблицы умножения
+    void subtractScaled(uint8_t* out, const std::vector<uint8_t>& b, uint8_t factor) const;
+    uint8_t inverse(uint8_t value) const;
+    void checkRules(const RingPolynomial& a) const;
+};
@@ -0,0 +1,72 @@
+// core/include/RingExpression.h
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "FiniteRingRules.h"
+#include "BigRingArithmetic.h"
+
+/*
+ * Скомпилированное выражение над числами кольца.
+ *
+ * Грамматика (по убыванию приоритета):
+ *   primary := литерал | переменная | '(' expr ')'
+ *   unary   := '-' unary | primary
+ *   term    := unary (('*' | '/' | '%') unary)*
+ *   expr    := term (('+' | '-') term)*
+ * '/' - частное, '%' - остаток BigRingArithmetic::divide.
+ * Слово из [A-Za-z0-9_] - переменная, если объявлена, иначе литерал кольца.
+ *
+ * Выражение разбирается один раз в постфиксный байткод (константные
+ * подвыражения сворачиваются), дальше вычисляется на любых привязках
+ * переменных без повторного разбора; пакет идёт с одним стеком.
+ */
+class RingExpression {
+public:
+    RingExpression(const FiniteRingRules& rules, const BigRingArithmetic& big,
+                   const std::string& source, std::vector<std::string> variables = {});
+
+    // * значения переменных - в порядке объявления
+    RingNumber evaluate(const std::vector<RingNumber>& bindings) const;
+    // * пакет: columns[v][i] - значение переменной v в строке i
+    std::vector<RingNumber> evaluateBatch(const std::vector<std::vector<RingNumber>>& columns) const;
+
+    const FiniteRingRules& getRules() const { return rules_; }
+    const std::string& getSource() const { return source_; }
+    const std::vector<std::string>& getVariables() const { return variables_; }
+    size_t codeSize() const { return code_.size(); }
+    // * байткод в читаемом виде, по инструкции в строке
+    std::string disassemble() const;
+
+private:
+    enum class OpCode : uint8_t { PushConst, PushVar, Add, Sub, Mul, Div, Mod, Neg };
+    struct Instruction {
+        OpCode op;
+        uint32_t operand;   // индекс константы или переменной
+    };
+
+    const FiniteRingRules& rules_;
+    const BigRingArithmetic& big_;
+    std::string source_;
+    std::vector<std::string> variables_;
+
+    std::vector<Instruction> code_;
+    std::vector<RingNumber> constants_;
+    size_t max_stack_ = 0;
+
+    // * разбор (рекурсивный спуск), pos_ - позиция в source_
+    size_t pos_ = 0;
+    void compile();
+    void parseExpr();
+    void parseTerm();
+    void parseUnary();
+    void parsePrimary();
+    void skipSpaces();
+    void emit(OpCode op, uint32_t operand = 0);
+    [[noreturn]] void fail(const std::string& message) const;
+
+    // * исполнение на готовом стеке; bindings(v) - значение переменной v
+    template <typename Bindings>
+    RingNumber run(std::vector<RingNumber>& stack, const Bindings& bindings) const;
+    RingNumber apply(OpCode op, const RingNumber& a, const RingNumber& b) const;
+};
@@ -0,0 +1,51 @@
+// core/include/RingMatrix.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "FiniteRingRules.h"
+
+/*
+ * Плотная матрица над кольцом варианта: индексы 0..N-1 по строкам
+ * подряд (row-major), строка - непрерывный отрезок uint8_t.
+ */
+class RingMatrix {
+public:
+    // * нулевая матрица rows × cols
+    RingMatrix(const FiniteRingRules& rules, size_t rows, size_t cols);
+    // * из индексов по строкам, values.size() = rows * cols
+    RingMatrix(const FiniteRingRules& rules, size_t rows, size_t cols, std::vector<uint8_t> values);
+
+    static RingMatrix identity(const FiniteRingRules& rules, size_t n);
+    // * из строк символов одинаковой длины (столбец 0 - первый символ)
+    static RingMatrix fromStrings(const FiniteRingRules& rules, const std::vector<std::string>& rows);
+
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    bool isSquare() const { return rows_ == cols_; }
+
+    // * доступ по индексам (без проверки границ)
+    uint8_t at(size_t row, size_t col) const { return values_[row * cols_ + col]; }
+    void set(size_t row, size_t col, uint8_t value) { values_[row * cols_ + col] = value; }
+    uint8_t* row(size_t index) { return values_.data() + index * cols_; }
+    const uint8_t* row(size_t index) const { return values_.data() + index * cols_; }
+    const std::vector<uint8_t>& getValues() const { return values_; }
+
+    // * столбцы [first, first + count) отдельной матрицей
+    RingMatrix columns(size_t first, size_t count) const;
+
+    // * строки символов через '\n'
+    std::string toString() const;
+
+    bool operator==(const RingMatrix& other) const;
+    bool operator!=(const RingMatrix& other) const { return !(*this == other); }
+
+    const FiniteRingRules& getRules() const { return *rules_; }
+
+private:
+    const FiniteRingRules* rules_;
+    size_t rows_;
+    size_t cols_;
+    std::vector<uint8_t> values_;
+};
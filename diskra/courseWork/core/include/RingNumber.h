@@ -2,13 +2,21 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <cstdint>
 #include "FiniteRingRules.h"
+#include "DigitBuffer.h"
 
 /*
  * Представляет многосимвольное число в конечном кольце.
  * Хранит цифры в порядке: младший разряд первым (little-endian).
- * 
- * Пример: число "abc" хранится как ['c', 'b', 'a']
+ * Цифры хранятся индексами 0..N-1 (значение = число шагов "+1" от нуля),
+ * алфавит символов применяется только при разборе строки и в toString().
+ *
+ * Пример (variant_1): число "gbc" хранится как [2, 1, 4]
+ *
+ * Значимый тип: правила хранятся указателем, цифры - в DigitBuffer
+ * (до 16 цифр без кучи), поэтому копирование короткого числа и
+ * перемещение любого не выделяют память.
  */
 class RingNumber {
 public:
@@ -16,25 +24,35 @@ public:
     explicit RingNumber(const FiniteRingRules& rules);
     RingNumber(const FiniteRingRules& rules, const std::string& value);
     RingNumber(const FiniteRingRules& rules, const std::vector<char>& digits, bool is_negative = false);
-    
-    // * копирование и присваивание
-    RingNumber(const RingNumber& other);
-    RingNumber& operator=(const RingNumber& other);
-    
-    // * доступ к цифрам (младший разряд = индекс 0)
+    // * из индексов цифр (младший разряд первым) без перевода через символы
+    RingNumber(const FiniteRingRules& rules, const std::vector<uint8_t>& values, bool is_negative = false);
+    RingNumber(const FiniteRingRules& rules, DigitBuffer values, bool is_negative = false);
+
+    // * копирование и перемещение; присваивание перепривязывает правила
+    RingNumber(const RingNumber& other) = default;
+    RingNumber(RingNumber&& other) noexcept = default;
+    RingNumber& operator=(const RingNumber& other) = default;
+    RingNumber& operator=(RingNumber&& other) noexcept = default;
+
+    // * доступ к цифрам (младший разряд = индекс 0), возвращают символы
     size_t length() const { return digits_.size(); }
     char operator[](size_t index) const;
-    char& operator[](size_t index);
-    char getDigit(size_t index) const; 
-    
+    char getDigit(size_t index) const;
+
+    // * доступ к индексам цифр (за пределами числа = 0)
+    uint8_t getDigitValue(size_t index) const {
+        return index < digits_.size() ? digits_[index] : 0;
+    }
+    const DigitBuffer& getValues() const { return digits_; }
+
     // * преобразования
     std::string toString() const;
-    std::vector<char> toVector() const { return digits_; }
-    
+    std::vector<char> toVector() const;
+
     // * модификация
     void normalize();  // удаляет ведущие нули
     void reverse();    // меняет порядок цифр
-    
+
     // * проверки
     bool isZero() const;
     bool isValid() const;
@@ -46,18 +64,18 @@ public:
     // * свойства многочлена
     size_t degree() const;
     char leadingCoefficient() const;
-    
+
     // * операторы сравнения
     bool operator==(const RingNumber& other) const;
     bool operator!=(const RingNumber& other) const;
-    
+
     // * получить правила
-    const FiniteRingRules& getRules() const { return rules_; }
-    
+    const FiniteRingRules& getRules() const { return *rules_; }
+
 private:
-    const FiniteRingRules& rules_;
-    std::vector<char> digits_; 
+    const FiniteRingRules* rules_;
+    DigitBuffer digits_;
     bool is_negative_ = false;
-    
-    void validate(); 
-};
\ No newline at end of file
+
+    void validate();
+};
@@ -0,0 +1,65 @@
+// core/include/RingPolynomial.h
+#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "FiniteRingRules.h"
+#include "RingNumber.h"
+
+/*
+ * Многочлен над кольцом варианта: коэффициенты - индексы 0..N-1,
+ * младшая степень первой (как цифры RingNumber), без старших нулей.
+ * Нулевой многочлен - пустой вектор коэффициентов, его степень -1.
+ *
+ * Строковая запись та же, что у RingNumber: символы от старшей
+ * степени к младшей, "gbc" = g*x^2 + b*x + c.
+ */
+class RingPolynomial {
+public:
+    // * нулевой многочлен
+    explicit RingPolynomial(const FiniteRingRules& rules);
+    // * из символов, старшая степень первой
+    RingPolynomial(const FiniteRingRules& rules, const std::string& coefficients);
+    // * из индексов, младшая степень первой
+    RingPolynomial(const FiniteRingRules& rules, std::vector<uint8_t> coefficients);
+
+    // * цифры числа как коэффициенты (знак отбрасывается)
+    static RingPolynomial fromRingNumber(const RingNumber& num);
+    RingNumber toRingNumber() const;
+
+    // * доступ к коэффициентам (за пределами степени = 0)
+    int degree() const { return static_cast<int>(coefficients_.size()) - 1; }
+    uint8_t coefficient(size_t power) const {
+        return power < coefficients_.size() ? coefficients_[power] : 0;
+    }
+    uint8_t leadingCoefficient() const { return coefficients_.empty() ? 0 : coefficients_.back(); }
+    const std::vector<uint8_t>& getCoefficients() const { return coefficients_; }
+    bool isZero() const { return coefficients_.empty(); }
+
+    std::string toString() const;
+
+    bool operator==(const RingPolynomial& other) const;
+    bool operator!=(const RingPolynomial& other) const { return !(*this == other); }
+
+    const FiniteRingRules& getRules() const { return *rules_; }
+
+private:
+    const FiniteRingRules* rules_;
+    std::vector<uint8_t> coefficients_;
+
+    void normalize();  // удаляет старшие нулевые коэффициенты
+};
+
+// * результат деления многочленов: a = q * b + r, deg r < deg b
+struct PolynomialDivisionResult {
+    RingPolynomial quotient;
+    RingPolynomial remainder;
+
+    PolynomialDivisionResult(RingPolynomial q, RingPolynomial r)
+        : quotient(std::move(q)), remainder(std::move(r)) {}
+
+    std::string toString() const {
+        return "Q: " + quotient.toString() + " | R: " + remainder.toString();
+    }
+};
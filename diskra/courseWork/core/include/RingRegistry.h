@@ -0,0 +1,45 @@
+// core/include/RingRegistry.h
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include "FiniteRingRules.h"
+
+/*
+ * Реестр вариантов из config.yaml.
+ * Файл разбирается один раз, все варианты проверяются и строятся сразу
+ * (вместе с таблицами), дальше правила раздаются по имени из кэша.
+ * Правила неизменяемы и живут, пока жив реестр или выданный shared_ptr.
+ */
+class RingRegistry {
+public:
+    // * загрузка и проверка всех вариантов файла
+    explicit RingRegistry(const std::string& config_file);
+
+    // * общий на процесс реестр для файла: первый вызов загружает, остальные - из кэша
+    static const RingRegistry& instance(const std::string& config_file = "config.yaml");
+
+    // * доступ к правилам по имени варианта
+    std::shared_ptr<const FiniteRingRules> get(const std::string& variant_name) const;
+    const FiniteRingRules& rules(const std::string& variant_name) const { return *get(variant_name); }
+    bool contains(const std::string& variant_name) const;
+
+    // * варианты в порядке файла и их группы (Z8, Z11, ...)
+    const std::vector<std::string>& getNames() const { return names_; }
+    const std::string& getGroup(const std::string& variant_name) const;
+    size_t size() const { return names_.size(); }
+    const std::string& getConfigFile() const { return config_file_; }
+
+private:
+    struct Entry {
+        std::string group;
+        std::shared_ptr<const FiniteRingRules> rules;
+    };
+
+    std::string config_file_;
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, Entry> entries_;
+
+    const Entry& find(const std::string& variant_name) const;
+};
@@ -0,0 +1,127 @@
+// core/include/RingStorage.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "FiniteRingRules.h"
+#include "RingNumber.h"
+
+/*
+ * Двоичный формат наборов RingNumber: цифры упакованы по
+ * w = ceil(log2 N) бит (Z8 - 3 бита, Z11 - 4), числа все в little-endian.
+ *
+ *   заголовок: "RNGS", версия u16, N u8, w u8, длина имени u16, имя
+ *              варианта, алфавит (N символов в порядке индексов)
+ *   записи:    varint (цифр << 1 | знак), затем цифры младшей первой
+ *              потоком по w бит, дополненным нулями до байта
+ *   конец:     varint 0
+ *   индекс:    смещение каждой 64-й записи, u64
+ *   хвост:     число записей u64, смещение индекса u64, "RNGX", u32 0
+ *
+ * Потоковое чтение идёт до varint 0 и хвоста не требует, поэтому
+ * запись работает и с непозиционируемыми потоками. Произвольный доступ
+ * по номеру (MappedRingStorage) находит по индексу начало блока из 64
+ * записей и пропускает не больше 63 записей, читая только их длины.
+ * Правила читателя проверяются по алфавиту из заголовка.
+ */
+
+// * заголовок файла
+struct StorageHeader {
+    std::string variant;
+    int size = 0;
+    unsigned bits = 0;
+    std::string alphabet;
+};
+
+class RingStorageWriter {
+public:
+    // * поток должен жить до close(); файл открывается и закрывается сам
+    RingStorageWriter(std::ostream& out, const FiniteRingRules& rules, const std::string& variant_name);
+    // ! бросает, если файл не открывается
+    RingStorageWriter(const std::string& path, const FiniteRingRules& rules, const std::string& variant_name);
+    // * незакрытый писатель закрывается (ошибки при этом глотаются)
+    ~RingStorageWriter();
+    RingStorageWriter(const RingStorageWriter&) = delete;
+    RingStorageWriter& operator=(const RingStorageWriter&) = delete;
+
+    // ! бросает, если число из другого кольца или писатель закрыт
+    void write(const RingNumber& num);
+    void writeMany(const std::vector<RingNumber>& nums);
+    // * конец записей, индекс и хвост; повторный вызов ничего не делает
+    void close();
+
+    uint64_t count() const { return count_; }
+
+private:
+    std::unique_ptr<std::ofstream> file_;
+    std::ostream& out_;
+    const FiniteRingRules& rules_;
+    unsigned bits_;
+    uint64_t count_ = 0;
+    uint64_t offset_ = 0;               // байт отдано в поток (с учётом буфера)
+    std::vector<uint64_t> index_;       // смещения каждой 64-й записи
+    std::string buffer_;
+    bool closed_ = false;
+
+    void writeHeader(const std::string& variant_name);
+    void flush();
+};
+
+class RingStorageReader {
+public:
+    // ! бросает, если заголовок испорчен или алфавит не совпадает с правилами
+    RingStorageReader(std::istream& in, const FiniteRingRules& rules);
+    RingStorageReader(const std::string& path, const FiniteRingRules& rules);
+
+    // * следующая запись; false - записи кончились
+    bool next(RingNumber& num);
+    // * до max_count записей подряд
+    std::vector<RingNumber> readMany(size_t max_count);
+
+    const StorageHeader& header() const { return header_; }
+    const FiniteRingRules& getRules() const { return rules_; }
+
+private:
+    std::unique_ptr<std::ifstream> file_;
+    std::istream& in_;
+    const FiniteRingRules& rules_;
+    StorageHeader header_;
+    std::vector<uint8_t> buffer_;
+    size_t position_ = 0;
+    size_t filled_ = 0;
+    bool finished_ = false;
+
+    uint8_t readByte();
+    void readBytes(uint8_t* out, size_t count);
+};
+
+class MappedRingStorage {
+public:
+    // ! бросает, если файл не открывается, испорчен или другого варианта
+    MappedRingStorage(const std::string& path, const FiniteRingRules& rules);
+    ~MappedRingStorage();
+    MappedRingStorage(const MappedRingStorage&) = delete;
+    MappedRingStorage& operator=(const MappedRingStorage&) = delete;
+
+    uint64_t size() const { return count_; }
+    // ! бросает при index >= size()
+    RingNumber at(uint64_t index) const;
+
+    const StorageHeader& header() const { return header_; }
+
+private:
+    const FiniteRingRules& rules_;
+    StorageHeader header_;
+    const uint8_t* data_ = nullptr;
+    size_t length_ = 0;
+    uint64_t count_ = 0;
+    uint64_t index_offset_ = 0;
+    uint64_t records_offset_ = 0;
+    std::vector<uint8_t> fallback_;     // без mmap файл читается целиком
+    bool mapped_ = false;
+};
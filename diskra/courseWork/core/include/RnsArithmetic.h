@@ -0,0 +1,114 @@
+// core/include/RnsArithmetic.h
+#pragma once
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "FiniteRingRules.h"
+#include "RingRegistry.h"
+#include "SmallRingArithmetic.h"
+#include "BigRingArithmetic.h"
+#include "WorkStealingPool.h"
+
+// * канал: остаток по модулю N^digits хранится числом кольца (digits цифр)
+struct RnsChannel {
+    std::shared_ptr<const FiniteRingRules> rules;
+    size_t digits = 0;  // 0 - k = floor(log_N 2^63), один limb
+};
+
+// * число в системе остаточных классов: по остатку на канал
+struct RnsNumber {
+    std::vector<RingNumber> residues;
+};
+
+/*
+ * Система остаточных классов над вариантами из config.yaml.
+ *
+ * Модуль канала - N^k, поэтому приведение по нему - просто отбросить
+ * цифры старше k-й: сложение и умножение в канале - обычная позиционная
+ * арифметика кольца с обрезкой, каналы между собой не связаны переносами.
+ * Одиночная операция проходит каналы подряд, параллельно считаются
+ * только пакеты (addMany, multiplyMany и перевод наборов).
+ * Модули каналов должны быть попарно взаимно просты (например Z8
+ * и Z11); диапазон - M = произведение модулей,
+ * числа со знаком - симметрично: [-(M - 1) / 2 .. M / 2].
+ *
+ * Позиционное число (в кольце output) восстанавливается по КТО только
+ * по запросу: X = sum(r_i * M_i * (M_i^-1 mod m_i)) mod M, константы
+ * считаются один раз в конструкторе.
+ */
+class RnsArithmetic {
+public:
+    // ! бросает, если модули каналов не взаимно просты
+    RnsArithmetic(std::vector<RnsChannel> channels, std::shared_ptr<const FiniteRingRules> output,
+                  unsigned threads = 0);
+    // * каналы по именам вариантов: (имя, цифр в канале)
+    RnsArithmetic(const RingRegistry& registry,
+                  const std::vector<std::pair<std::string, size_t>>& channels,
+                  const std::string& output_variant, unsigned threads = 0);
+    ~RnsArithmetic();
+
+    // * перевод: число любого кольца -> остатки, остатки -> число кольца output
+    // ! fromRingNumber бросает, если число вне диапазона системы
+    RnsNumber fromRingNumber(const RingNumber& num) const;
+    RingNumber toRingNumber(const RnsNumber& num) const;
+
+    // * арифметика по каналам (без переносов между каналами, каналы подряд)
+    RnsNumber add(const RnsNumber& a, const RnsNumber& b) const;
+    RnsNumber subtract(const RnsNumber& a, const RnsNumber& b) const;
+    RnsNumber multiply(const RnsNumber& a, const RnsNumber& b) const;
+    RnsNumber negate(const RnsNumber& a) const;
+
+    // * пакеты: пары (элемент, канал) раздаются пулу потоков
+    std::vector<RnsNumber> addMany(const std::vector<RnsNumber>& a, const std::vector<RnsNumber>& b) const;
+    std::vector<RnsNumber> multiplyMany(const std::vector<RnsNumber>& a, const std::vector<RnsNumber>& b) const;
+    std::vector<RnsNumber> fromRingNumbers(const std::vector<RingNumber>& nums) const;
+    std::vector<RingNumber> toRingNumbers(const std::vector<RnsNumber>& nums) const;
+
+    size_t channelCount() const { return channels_.size(); }
+    const FiniteRingRules& channelRules(size_t channel) const;
+    size_t channelDigits(size_t channel) const;
+    // * модуль системы M и модуль канала - числа кольца output
+    const RingNumber& getModulus() const;
+    RingNumber channelModulus(size_t channel) const;
+    const FiniteRingRules& getOutputRules() const { return *output_; }
+
+private:
+    // правила и арифметика кольца (малая арифметика нужна большой по ссылке)
+    struct Ring {
+        std::shared_ptr<const FiniteRingRules> rules;
+        std::unique_ptr<SmallRingArithmetic> small;
+        std::unique_ptr<BigRingArithmetic> big;
+
+        explicit Ring(std::shared_ptr<const FiniteRingRules> ring_rules);
+    };
+    struct Channel {
+        Ring ring;
+        size_t digits;
+        RingNumber modulus;             // N^digits в кольце канала
+    };
+
+    std::vector<Channel> channels_;
+    std::shared_ptr<const FiniteRingRules> output_;
+    Ring out_;
+    std::unique_ptr<WorkStealingPool> pool_;
+
+    // * константы КТО в кольце output
+    RingNumber modulus_;                // M
+    RingNumber half_;                   // M / 2 - граница положительных
+    std::vector<RingNumber> channel_moduli_;  // m_i
+    std::vector<RingNumber> crt_terms_; // M_i * (M_i^-1 mod m_i)
+
+    enum class Op { Add, Subtract, Multiply };
+    RingNumber channelOp(size_t channel, Op op, const RingNumber& a, const RingNumber& b) const;
+    RingNumber channelNegate(size_t channel, const RingNumber& a) const;
+    RnsNumber apply(Op op, const RnsNumber& a, const RnsNumber& b) const;
+    std::vector<RnsNumber> applyMany(Op op, const std::vector<RnsNumber>& a,
+                                     const std::vector<RnsNumber>& b) const;
+
+    // * модуль числа в другом основании (схема Горнера по limb'ам),
+    // * keep_digits != 0 - по модулю N^keep_digits
+    RingNumber convert(const RingNumber& num, const Ring& target, size_t keep_digits) const;
+    RingNumber channelResidue(size_t channel, const RingNumber& magnitude, bool negative) const;
+    void checkShape(const RnsNumber& num) const;
+};
@@ -1,9 +1,13 @@
 #pragma once
+#include <cstddef>
 #include "FiniteRingRules.h"
 
 class SmallRingArithmetic {
 public:
-    explicit SmallRingArithmetic(const FiniteRingRules& r) : rules_(r) {}
+    explicit SmallRingArithmetic(const FiniteRingRules& r)
+        : rules_(r), size_(r.getSize()),
+          add_(r.getAddTable().data()), sub_(r.getSubTable().data()),
+          mul_(r.getMulTable().data()) {}
 
     // * арифметические операции в поле
     char add(char a, char b) const;
@@ -11,6 +15,23 @@ public:
     char multiply(char a, char b) const;
     char divide(char a, char b) const;
 
+    // * те же операции над индексами (0..N-1): один доступ к таблице
+    uint8_t addIndex(uint8_t a, uint8_t b) const { return add_[a * size_ + b]; }
+    uint8_t subtractIndex(uint8_t a, uint8_t b) const { return sub_[a * size_ + b]; }
+    uint8_t multiplyIndex(uint8_t a, uint8_t b) const { return mul_[a * size_ + b]; }
+
+    // * пакетные операции над массивами индексов: out[i] = a[i] (op) b[i]
+    // ! для N <= 16 работают байтовые перестановки (pshufb, SSSE3/AVX2),
+    // ! ядро выбирается при первом вызове по возможностям процессора
+    void addMany(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count) const;
+    void subMany(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count) const;
+    void mulMany(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count) const;
+    // ! бросает исключение, если среди a есть необратимый элемент (out не тронут);
+    // * out может совпадать с a
+    void invMany(const uint8_t* a, uint8_t* out, size_t count) const;
+    // * имя выбранного ядра: "avx2", "ssse3" или "scalar"
+    static const char* batchKernelName();
+
     // * получить правила поля
     const FiniteRingRules& getRules() const { return rules_; }
     // * методы поиска обратных элементов
@@ -21,4 +42,12 @@ public:
 private:
     // ссылка на правила поля
     const FiniteRingRules& rules_;
+
+    // таблицы Кэли из правил (живут столько же, сколько rules_)
+    int size_;
+    const uint8_t* add_;
+    const uint8_t* sub_;
+    const uint8_t* mul_;
+
+    void checkIndices(const uint8_t* values, size_t count) const;
 };
@@ -0,0 +1,66 @@
+// core/include/StaticRingArithmetic.h
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+/*
+ * Арифметика кольца, известного на этапе компиляции.
+ * Ring - описатель из сгенерированного RingVariants.h (rings::Z8_variant_1, ...):
+ * размер, символы и таблицы Кэли как constexpr-массивы. Все операции -
+ * одна выборка из таблицы с постоянным шагом, без правил в памяти и
+ * без косвенных вызовов, так что компилятор встраивает их целиком.
+ *
+ * Семантика и тексты ошибок совпадают с SmallRingArithmetic; кольца,
+ * загружаемые в рантайме, по-прежнему идут через FiniteRingRules.
+ */
+template <class Ring>
+class StaticRingArithmetic {
+public:
+    static constexpr int SIZE = Ring::size;
+    static constexpr uint8_t NO_INVERSE = 0xFF;
+
+    static_assert(SIZE >= 2 && SIZE <= 255, "Ring size must be in range [2, 255]");
+    static_assert(sizeof(Ring::add_table) == SIZE * SIZE, "Cayley table must be N x N");
+
+    // * операции над индексами (0..N-1)
+    static constexpr uint8_t addIndex(uint8_t a, uint8_t b) { return Ring::add_table[a * SIZE + b]; }
+    static constexpr uint8_t subtractIndex(uint8_t a, uint8_t b) { return Ring::sub_table[a * SIZE + b]; }
+    static constexpr uint8_t multiplyIndex(uint8_t a, uint8_t b) { return Ring::mul_table[a * SIZE + b]; }
+    static constexpr uint8_t negateIndex(uint8_t a) { return Ring::neg_table[a]; }
+    // ! NO_INVERSE, если обратного нет
+    static constexpr uint8_t inverseIndex(uint8_t a) { return Ring::inv_table[a]; }
+
+    // * символ <-> индекс
+    static constexpr bool isValidChar(char c) { return Ring::index_table[static_cast<unsigned char>(c)] >= 0; }
+    static constexpr char toChar(uint8_t v) { return Ring::symbols[v]; }
+    static constexpr uint8_t toIndex(char c) {
+        if (!isValidChar(c)) {
+            throw std::runtime_error("Invalid character: '" + std::string(1, c) + "' (not in ring)");
+        }
+        return static_cast<uint8_t>(Ring::index_table[static_cast<unsigned char>(c)]);
+    }
+
+    // * операции над символами
+    static constexpr char add(char a, char b) { return toChar(addIndex(toIndex(a), toIndex(b))); }
+    static constexpr char subtract(char a, char b) { return toChar(subtractIndex(toIndex(a), toIndex(b))); }
+    static constexpr char multiply(char a, char b) { return toChar(multiplyIndex(toIndex(a), toIndex(b))); }
+    static constexpr char divide(char a, char b) {
+        if (b == Ring::zero) {
+            throw std::runtime_error("Division by zero");
+        }
+        return multiply(a, findMultiplicativeInverse(b));
+    }
+
+    static constexpr char findAdditiveInverse(char element) { return toChar(negateIndex(toIndex(element))); }
+    static constexpr char findMultiplicativeInverse(char element) {
+        if (element == Ring::zero) {
+            throw std::runtime_error("Zero has no multiplicative inverse");
+        }
+        const uint8_t inv = inverseIndex(toIndex(element));
+        if (inv == NO_INVERSE) {
+            throw std::runtime_error("No multiplicative inverse for element: " + std::string(1, element));
+        }
+        return toChar(inv);
+    }
+};
@@ -0,0 +1,46 @@
+// core/include/TableGenerator.h
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "FiniteRingRules.h"
+
+// * таблицы N×N: результаты операций и переносы разряда
+enum class TableKind : uint8_t { Add, Multiply, AddCarry, MultiplyCarry };
+// * форматы отчёта
+enum class TableFormat : uint8_t { Csv, Markdown, Latex };
+
+/*
+ * Все таблицы варианта за один проход по парам (a, b).
+ * Ячейка [a * N + b] - индекс результата (или переноса) для a (op) b;
+ * при выводе индексы заменяются символами кольца. Вывод идёт через
+ * буферизованный писатель: поток получает данные крупными блоками.
+ */
+class TableGenerator {
+public:
+    explicit TableGenerator(const FiniteRingRules& rules);
+
+    const std::vector<uint8_t>& table(TableKind kind) const;
+    int getSize() const { return rules_.getSize(); }
+
+    // * одна таблица или все четыре подряд (с заголовками)
+    void write(std::ostream& out, TableKind kind, TableFormat format) const;
+    void writeAll(std::ostream& out, TableFormat format) const;
+    std::string render(TableKind kind, TableFormat format) const;
+    std::string renderAll(TableFormat format) const;
+    // ! бросает, если файл не открывается
+    void writeFile(const std::string& path, TableFormat format) const;
+
+    static std::string tableTitle(TableKind kind);
+    // * "csv", "md"/"markdown", "tex"/"latex"
+    static TableFormat parseFormat(const std::string& name);
+    static const std::vector<TableKind>& allTables();
+
+private:
+    const FiniteRingRules& rules_;
+    std::vector<uint8_t> add_;
+    std::vector<uint8_t> multiply_;
+    std::vector<uint8_t> add_carry_;
+    std::vector<uint8_t> multiply_carry_;
+};
@@ -0,0 +1,83 @@
+// core/include/WorkStealingPool.h
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Пул потоков с кражей работы.
+ *
+ * parallelFor делит [0, count) на непрерывные блоки поровну между
+ * потоками. Поток отрезает от начала своего блока диапазоны по grain,
+ * а опустев - крадёт верхнюю половину остатка чужого блока, так что
+ * неравные по цене диапазоны (длинные числа, ранний выход) не оставляют
+ * потоки без дела. Делится всё лениво: память - O(потоков), а не
+ * O(count / grain). Потоки живут всё время жизни пула и спят между вызовами.
+ */
+class WorkStealingPool {
+public:
+    // * body(begin, end): false - остальные диапазоны пропускаются
+    using RangeBody = std::function<bool(uint64_t begin, uint64_t end)>;
+
+    // ! threads = 0 - по числу ядер
+    explicit WorkStealingPool(unsigned threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // * true, если все диапазоны выполнены; исключение из body
+    // * останавливает цикл и пробрасывается вызывающему.
+    // * on_wait вызывается в вызывающем потоке раз в interval, пока идёт работа
+    bool parallelFor(uint64_t count, uint64_t grain, const RangeBody& body,
+                     const std::function<void()>& on_wait = nullptr,
+                     std::chrono::milliseconds interval = std::chrono::milliseconds(100));
+
+    unsigned size() const { return static_cast<unsigned>(workers_.size()); }
+
+private:
+    // диапазон несёт тело своего вызова: поток, опоздавший с прошлого
+    // вызова, не перепутает его с новым
+    struct Range {
+        uint64_t begin;
+        uint64_t end;
+        const RangeBody* body;
+    };
+    // непрерывный остаток работы потока (начало - владелец, верх - воры).
+    // поток трогает только блоки того вызова, на который проснулся: иначе
+    // опоздавший вор перезапишет свой блок, только что выданный новым вызовом
+    struct Queue {
+        std::mutex mutex;
+        uint64_t generation = 0;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+        uint64_t grain = 1;
+        const RangeBody* body = nullptr;
+    };
+
+    std::vector<std::thread> workers_;
+    std::vector<std::unique_ptr<Queue>> queues_;
+
+    // * текущий вызов parallelFor
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_ = 0;
+    uint64_t pending_ = 0;          // невыполненные индексы
+    std::atomic<bool> stop_{false}; // ранний выход или исключение
+    std::exception_ptr error_;
+    bool shutdown_ = false;
+
+    std::mutex call_mutex_;         // вызовы parallelFor идут по одному
+
+    void workerLoop(unsigned index);
+    bool takeRange(unsigned index, uint64_t generation, Range& range);
+    void finishRange(uint64_t items);
+};
@@ -1,14 +1,100 @@
 // core/py_binding.cc
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/numpy.h>
+#include <algorithm>
+#include <cstdint>
 #include "FiniteRingRules.h"
+#include "RingRegistry.h"
 #include "SmallRingArithmetic.h"
 #include "BigRingArithmetic.h"
 #include "RingNumber.h"
 #include "DivisionResult.h"
+#include "GcdResult.h"
+#include "PackedRingNumber.h"
+#include "RingExpression.h"
+#include "TableGenerator.h"
+#include "RnsArithmetic.h"
+#include "RingPolynomial.h"
+#include "PolynomialArithmetic.h"
+#include "RingMatrix.h"
+#include "MatrixArithmetic.h"
+#include "RingStorage.h"
 
 namespace py = pybind11;
 
+// * массив индексов uint8 в C-порядке: numpy-массив такого типа
+// * передаётся без копирования, остальное приводится один раз
+using IndexArray = py::array_t<uint8_t, py::array::c_style>;
+using WideArray = py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+using BinaryKernel = void (SmallRingArithmetic::*)(const uint8_t*, const uint8_t*, uint8_t*, size_t) const;
+
+static std::vector<py::ssize_t> shapeOf(const IndexArray& arr) {
+     return std::vector<py::ssize_t>(arr.shape(), arr.shape() + arr.ndim());
+}
+
+// * индексы из любого целочисленного массива или списка (np.array([1, 2]) - int64).
+// ! приведение к uint8 заворачивает 300 в 44, поэтому диапазон байта проверяется
+// ! до копии; 0..N-1 проверяет уже ядро. Нецелые типы отвергаются
+static IndexArray toIndices(const py::object& values) {
+     if (IndexArray::check_(values)) {
+          return py::reinterpret_borrow<IndexArray>(values);
+     }
+     const py::array arr = py::array::ensure(values);
+     if (!arr) {
+          throw std::runtime_error("Batch operand must be an integer array");
+     }
+     const char kind = arr.dtype().kind();
+     if (kind != 'i' && kind != 'u' && kind != 'b') {
+          throw std::runtime_error("Batch operand must be an integer array, got dtype kind '" +
+                                   std::string(1, kind) + "'");
+     }
+     const WideArray wide = WideArray::ensure(arr);
+     IndexArray out(std::vector<py::ssize_t>(wide.shape(), wide.shape() + wide.ndim()));
+     const int64_t* src = wide.data();
+     uint8_t* dst = out.mutable_data();
+     for (py::ssize_t i = 0; i < wide.size(); ++i) {
+          if (src[i] < 0 || src[i] > UINT8_MAX) {
+               throw std::runtime_error("Batch operand index out of ring range: " + std::to_string(src[i]));
+          }
+          dst[i] = static_cast<uint8_t>(src[i]);
+     }
+     return out;
+}
+
+// * пакетная операция: ядро работает с отпущенным GIL
+static IndexArray binaryBatch(const SmallRingArithmetic& small, const py::object& a_values,
+                              const py::object& b_values, BinaryKernel kernel) {
+     const IndexArray a = toIndices(a_values);
+     const IndexArray b = toIndices(b_values);
+     if (shapeOf(a) != shapeOf(b)) {
+          throw std::runtime_error("Batch operands must have the same shape");
+     }
+     IndexArray out(shapeOf(a));
+     const uint8_t* pa = a.data();
+     const uint8_t* pb = b.data();
+     uint8_t* po = out.mutable_data();
+     const size_t count = static_cast<size_t>(a.size());
+     {
+          py::gil_scoped_release release;
+          (small.*kernel)(pa, pb, po, count);
+     }
+     return out;
+}
+
+static IndexArray inverseBatch(const SmallRingArithmetic& small, const py::object& a_values) {
+     const IndexArray a = toIndices(a_values);
+     IndexArray out(shapeOf(a));
+     const uint8_t* pa = a.data();
+     uint8_t* po = out.mutable_data();
+     const size_t count = static_cast<size_t>(a.size());
+     {
+          py::gil_scoped_release release;
+          small.invMany(pa, po, count);
+     }
+     return out;
+}
+
 PYBIND11_MODULE(finite_ring_module, m) {
      m.doc() = "Finite Ring Arithmetic Module - Small and Big arithmetic";
     
@@ -25,7 +111,26 @@ PYBIND11_MODULE(finite_ring_module, m) {
                py::arg("value"))
           .def("isValidChar", &FiniteRingRules::isValidChar,
                py::arg("c"))
+          .def("getOrderedValues", &FiniteRingRules::getOrderedValues)
           .def("printRules", &FiniteRingRules::printRules);
+
+     // * --- RingRegistry * ---
+     // реестр живёт до конца процесса, Python получает только ссылки
+     py::class_<RingRegistry, std::unique_ptr<RingRegistry, py::nodelete>>(m, "RingRegistry")
+          .def_static("instance", &RingRegistry::instance,
+               py::arg("config_file") = "config.yaml",
+               py::return_value_policy::reference)
+          .def("rules", &RingRegistry::rules,
+               py::arg("variant_name"),
+               py::return_value_policy::reference_internal)
+          .def("contains", &RingRegistry::contains,
+               py::arg("variant_name"))
+          .def("getNames", &RingRegistry::getNames)
+          .def("getGroup", &RingRegistry::getGroup,
+               py::arg("variant_name"))
+          .def("getConfigFile", &RingRegistry::getConfigFile)
+          .def("__len__", &RingRegistry::size)
+          .def("__contains__", &RingRegistry::contains);
     
      // * --- SmallRingArithmetic * ---
      py::class_<SmallRingArithmetic>(m, "SmallRingArithmetic")
@@ -41,6 +146,18 @@ PYBIND11_MODULE(finite_ring_module, m) {
                 py::arg("a"), py::arg("b"))
           .def("findMultiplicativeInverse", &SmallRingArithmetic::findMultiplicativeInverse,
                py::arg("element"))
+          // пакетные операции над numpy-массивами индексов (0..N-1)
+          .def("add_many", [](const SmallRingArithmetic& s, const py::object& a, const py::object& b) {
+                    return binaryBatch(s, a, b, &SmallRingArithmetic::addMany);
+               }, py::arg("a"), py::arg("b"))
+          .def("sub_many", [](const SmallRingArithmetic& s, const py::object& a, const py::object& b) {
+                    return binaryBatch(s, a, b, &SmallRingArithmetic::subMany);
+               }, py::arg("a"), py::arg("b"))
+          .def("mul_many", [](const SmallRingArithmetic& s, const py::object& a, const py::object& b) {
+                    return binaryBatch(s, a, b, &SmallRingArithmetic::mulMany);
+               }, py::arg("a"), py::arg("b"))
+          .def("inv_many", &inverseBatch, py::arg("a"))
+          .def_static("batchKernelName", &SmallRingArithmetic::batchKernelName)
           .def("getRules", &SmallRingArithmetic::getRules,
                py::return_value_policy::reference_internal);
 
@@ -48,15 +165,46 @@ PYBIND11_MODULE(finite_ring_module, m) {
      py::class_<BigRingArithmetic>(m, "BigRingArithmetic")
           .def(py::init<const FiniteRingRules&, const SmallRingArithmetic&>(),
                 py::arg("rules"), py::arg("small"))
-          .def("add", &BigRingArithmetic::add,
+          .def("add", py::overload_cast<const RingNumber&, const RingNumber&>(
+                    &BigRingArithmetic::add, py::const_),
                 py::arg("a"), py::arg("b"))
-          .def("subtract", &BigRingArithmetic::subtract,
+          .def("subtract", py::overload_cast<const RingNumber&, const RingNumber&>(
+                    &BigRingArithmetic::subtract, py::const_),
                 py::arg("a"), py::arg("b"))
           .def("multiply", &BigRingArithmetic::multiply,
                py::arg("a"), py::arg("b"))
           .def("divide", &BigRingArithmetic::divide,
                py::arg("a"), py::arg("b"))
-          .def("negate", &BigRingArithmetic::negate);
+          .def("negate", py::overload_cast<const RingNumber&>(
+                    &BigRingArithmetic::negate, py::const_))
+          // степень: показатель - int или RingNumber
+          .def("pow", py::overload_cast<const RingNumber&, uint64_t>(
+                    &BigRingArithmetic::pow, py::const_),
+                py::arg("base"), py::arg("exponent"))
+          .def("pow", py::overload_cast<const RingNumber&, const RingNumber&>(
+                    &BigRingArithmetic::pow, py::const_),
+                py::arg("base"), py::arg("exponent"))
+          .def("powFixed", py::overload_cast<const RingNumber&, uint64_t>(
+                    &BigRingArithmetic::powFixed, py::const_),
+                py::arg("base"), py::arg("exponent"))
+          .def("powFixed", py::overload_cast<const RingNumber&, const RingNumber&>(
+                    &BigRingArithmetic::powFixed, py::const_),
+                py::arg("base"), py::arg("exponent"))
+          // НОД, коэффициенты Безу и обратный по модулю
+          .def("gcd", &BigRingArithmetic::gcd, py::arg("a"), py::arg("b"))
+          .def("extendedGcd", &BigRingArithmetic::extendedGcd, py::arg("a"), py::arg("b"))
+          .def("modInverse", &BigRingArithmetic::modInverse, py::arg("a"), py::arg("m"))
+          // упакованный режим
+          .def("add", py::overload_cast<const PackedRingNumber&, const PackedRingNumber&>(
+                    &BigRingArithmetic::add, py::const_),
+                py::arg("a"), py::arg("b"))
+          .def("subtract", py::overload_cast<const PackedRingNumber&, const PackedRingNumber&>(
+                    &BigRingArithmetic::subtract, py::const_),
+                py::arg("a"), py::arg("b"))
+          .def("negate", py::overload_cast<const PackedRingNumber&>(
+                    &BigRingArithmetic::negate, py::const_))
+          .def("compare", &BigRingArithmetic::compare,
+                py::arg("a"), py::arg("b"));
     
      // * --- RingNumber * ---
      py::class_<RingNumber>(m, "RingNumber")
@@ -66,9 +214,17 @@ PYBIND11_MODULE(finite_ring_module, m) {
                py::arg("rules"), py::arg("value"))
           .def(py::init<const FiniteRingRules&, const std::vector<char>&, bool>(),
                py::arg("rules"), py::arg("value"), py::arg("is_negative") = false)
+          .def(py::init<const FiniteRingRules&, const std::vector<uint8_t>&, bool>(),
+               py::arg("rules"), py::arg("values"), py::arg("is_negative") = false)
           .def("length", &RingNumber::length)
           .def("getDigit", &RingNumber::getDigit,
                py::arg("index"))
+          .def("getDigitValue", &RingNumber::getDigitValue,
+               py::arg("index"))
+          .def("getValues", [](const RingNumber& n) {
+               const DigitBuffer& values = n.getValues();
+               return std::vector<uint8_t>(values.begin(), values.end());
+          })
           .def("toString", &RingNumber::toString)
           .def("normalize", &RingNumber::normalize)
           .def("isZero", &RingNumber::isZero)
@@ -85,6 +241,21 @@ PYBIND11_MODULE(finite_ring_module, m) {
             return "RingNumber('" + n.toString() + "')";
         });
      
+     // * --- PackedRingNumber * ---
+     py::class_<PackedRingNumber>(m, "PackedRingNumber")
+          .def(py::init<const FiniteRingRules&>(),
+               py::arg("rules"))
+          .def(py::init<const RingNumber&>(),
+               py::arg("number"))
+          .def("toRingNumber", &PackedRingNumber::toRingNumber)
+          .def("toString", &PackedRingNumber::toString)
+          .def("limbCount", &PackedRingNumber::limbCount)
+          .def("isZero", &PackedRingNumber::isZero)
+          .def("isNegative", &PackedRingNumber::isNegative)
+          .def("__eq__", &PackedRingNumber::operator==)
+          .def("__ne__", &PackedRingNumber::operator!=)
+          .def("__str__", &PackedRingNumber::toString);
+
      // * --- DivisionResult ---
      py::class_<DivisionResult>(m, "DivisionResult")
           .def(py::init<const RingNumber&, const RingNumber&>(),
@@ -92,5 +263,227 @@ PYBIND11_MODULE(finite_ring_module, m) {
           .def_readonly("quotient", &DivisionResult::quotient) 
           .def_readonly("remainder", &DivisionResult::remainder)
           .def("toString", &DivisionResult::toString);
+
+     // * --- GcdResult ---
+     py::class_<GcdResult>(m, "GcdResult")
+          .def_readonly("gcd", &GcdResult::gcd)
+          .def_readonly("x", &GcdResult::x)
+          .def_readonly("y", &GcdResult::y)
+          .def("toString", &GcdResult::toString);
+
+     // * --- RingExpression * ---
+     // выражение держит ссылки на правила и арифметику: не даём им умереть раньше
+     py::class_<RingExpression>(m, "RingExpression")
+          .def(py::init<const FiniteRingRules&, const BigRingArithmetic&,
+                        const std::string&, std::vector<std::string>>(),
+               py::arg("rules"), py::arg("big"), py::arg("source"),
+               py::arg("variables") = std::vector<std::string>{},
+               py::keep_alive<1, 2>(), py::keep_alive<1, 3>())
+          .def("evaluate", &RingExpression::evaluate,
+               py::arg("bindings") = std::vector<RingNumber>{})
+          // пакет: columns[v][i] - значение переменной v в строке i
+          .def("evaluate_batch", [](const RingExpression& e,
+                                    const std::vector<std::vector<RingNumber>>& columns) {
+                    py::gil_scoped_release release;
+                    return e.evaluateBatch(columns);
+               }, py::arg("columns"))
+          // то же над строками: разбор, вычисление и печать без возврата в Python
+          .def("evaluate_strings", [](const RingExpression& e,
+                                      const std::vector<std::vector<std::string>>& columns) {
+                    py::gil_scoped_release release;
+                    std::vector<std::vector<RingNumber>> numbers(columns.size());
+                    for (size_t v = 0; v < columns.size(); ++v) {
+                         numbers[v].reserve(columns[v].size());
+                         for (const std::string& s : columns[v]) {
+                              numbers[v].emplace_back(e.getRules(), s);
+                         }
+                    }
+                    std::vector<std::string> results;
+                    for (const RingNumber& r : e.evaluateBatch(numbers)) {
+                         results.push_back(r.toString());
+                    }
+                    return results;
+               }, py::arg("columns"))
+          .def("getSource", &RingExpression::getSource)
+          .def("getVariables", &RingExpression::getVariables)
+          .def("codeSize", &RingExpression::codeSize)
+          .def("disassemble", &RingExpression::disassemble);
+
+     // * --- TableGenerator * ---
+     py::enum_<TableKind>(m, "TableKind")
+          .value("Add", TableKind::Add)
+          .value("Multiply", TableKind::Multiply)
+          .value("AddCarry", TableKind::AddCarry)
+          .value("MultiplyCarry", TableKind::MultiplyCarry);
+
+     py::enum_<TableFormat>(m, "TableFormat")
+          .value("Csv", TableFormat::Csv)
+          .value("Markdown", TableFormat::Markdown)
+          .value("Latex", TableFormat::Latex);
+
+     py::class_<TableGenerator>(m, "TableGenerator")
+          .def(py::init<const FiniteRingRules&>(), py::arg("rules"), py::keep_alive<1, 2>())
+          .def("getSize", &TableGenerator::getSize)
+          // таблица индексов N×N одним массивом
+          .def("table", [](const TableGenerator& g, TableKind kind) {
+                    const std::vector<uint8_t>& cells = g.table(kind);
+                    IndexArray out({g.getSize(), g.getSize()});
+                    std::copy(cells.begin(), cells.end(), out.mutable_data());
+                    return out;
+               }, py::arg("kind"))
+          .def("render", &TableGenerator::render, py::arg("kind"), py::arg("format"))
+          .def("renderAll", &TableGenerator::renderAll, py::arg("format"))
+          .def("writeFile", &TableGenerator::writeFile, py::arg("path"), py::arg("format"))
+          .def_static("parseFormat", &TableGenerator::parseFormat, py::arg("name"));
+
+     // * --- RnsArithmetic ---
+     py::class_<RnsNumber>(m, "RnsNumber")
+          .def(py::init<>())
+          .def_readwrite("residues", &RnsNumber::residues);
+
+     py::class_<RnsArithmetic>(m, "RnsArithmetic")
+          // правила каналов держатся shared_ptr, реестр можно не продлевать
+          .def(py::init<const RingRegistry&, const std::vector<std::pair<std::string, size_t>>&,
+                        const std::string&, unsigned>(),
+               py::arg("registry"), py::arg("channels"), py::arg("output_variant"), py::arg("threads") = 0)
+          .def("fromRingNumber", &RnsArithmetic::fromRingNumber, py::arg("num"))
+          .def("toRingNumber", &RnsArithmetic::toRingNumber, py::arg("num"))
+          .def("add", &RnsArithmetic::add)
+          .def("subtract", &RnsArithmetic::subtract)
+          .def("multiply", &RnsArithmetic::multiply)
+          .def("negate", &RnsArithmetic::negate)
+          .def("addMany", &RnsArithmetic::addMany, py::call_guard<py::gil_scoped_release>())
+          .def("multiplyMany", &RnsArithmetic::multiplyMany, py::call_guard<py::gil_scoped_release>())
+          .def("fromRingNumbers", &RnsArithmetic::fromRingNumbers, py::call_guard<py::gil_scoped_release>())
+          .def("toRingNumbers", &RnsArithmetic::toRingNumbers, py::call_guard<py::gil_scoped_release>())
+          .def("channelCount", &RnsArithmetic::channelCount)
+          .def("channelDigits", &RnsArithmetic::channelDigits)
+          .def("getModulus", &RnsArithmetic::getModulus)
+          .def("channelModulus", &RnsArithmetic::channelModulus);
+
+     // * --- RingPolynomial ---
+     py::class_<RingPolynomial>(m, "RingPolynomial")
+          .def(py::init<const FiniteRingRules&>(), py::arg("rules"), py::keep_alive<1, 2>())
+          .def(py::init<const FiniteRingRules&, const std::string&>(),
+               py::arg("rules"), py::arg("coefficients"), py::keep_alive<1, 2>())
+          .def(py::init<const FiniteRingRules&, std::vector<uint8_t>>(),
+               py::arg("rules"), py::arg("coefficients"), py::keep_alive<1, 2>())
+          .def_static("fromRingNumber", &RingPolynomial::fromRingNumber, py::arg("num"))
+          .def("toRingNumber", &RingPolynomial::toRingNumber)
+          .def("degree", &RingPolynomial::degree)
+          .def("coefficient", &RingPolynomial::coefficient, py::arg("power"))
+          .def("leadingCoefficient", &RingPolynomial::leadingCoefficient)
+          .def("getCoefficients", &RingPolynomial::getCoefficients)
+          .def("isZero", &RingPolynomial::isZero)
+          .def("toString", &RingPolynomial::toString)
+          .def("__str__", &RingPolynomial::toString)
+          .def("__eq__", &RingPolynomial::operator==);
+
+     py::class_<PolynomialDivisionResult>(m, "PolynomialDivisionResult")
+          .def_readonly("quotient", &PolynomialDivisionResult::quotient)
+          .def_readonly("remainder", &PolynomialDivisionResult::remainder)
+          .def("toString", &PolynomialDivisionResult::toString);
+
+     py::class_<PolynomialArithmetic>(m, "PolynomialArithmetic")
+          .def(py::init<const SmallRingArithmetic&>(), py::arg("small"), py::keep_alive<1, 2>())
+          .def("add", &PolynomialArithmetic::add)
+          .def("subtract", &PolynomialArithmetic::subtract)
+          .def("negate", &PolynomialArithmetic::negate)
+          .def("multiply", &PolynomialArithmetic::multiply)
+          .def("scale", &PolynomialArithmetic::scale, py::arg("a"), py::arg("factor"))
+          .def("divide", &PolynomialArithmetic::divide)
+          .def("gcd", &PolynomialArithmetic::gcd)
+          .def("monic", &PolynomialArithmetic::monic)
+          .def("evaluate", &PolynomialArithmetic::evaluate, py::arg("a"), py::arg("x"))
+          .def("isField", &PolynomialArithmetic::isField);
+
+     // * --- RingMatrix ---
+     py::class_<RingMatrix>(m, "RingMatrix")
+          .def(py::init<const FiniteRingRules&, size_t, size_t>(),
+               py::arg("rules"), py::arg("rows"), py::arg("cols"), py::keep_alive<1, 2>())
+          // из двумерного массива индексов (копия)
+          .def(py::init([](const FiniteRingRules& rules, const py::object& array) {
+                    const IndexArray values = toIndices(array);
+                    if (values.ndim() != 2) {
+                         throw std::runtime_error("Matrix requires a 2-dimensional array");
+                    }
+                    const size_t rows = static_cast<size_t>(values.shape(0));
+                    const size_t cols = static_cast<size_t>(values.shape(1));
+                    return RingMatrix(rules, rows, cols,
+                                      std::vector<uint8_t>(values.data(), values.data() + rows * cols));
+               }), py::arg("rules"), py::arg("values"), py::keep_alive<1, 2>())
+          .def_static("identity", &RingMatrix::identity, py::arg("rules"), py::arg("n"), py::keep_alive<0, 1>())
+          .def_static("fromStrings", &RingMatrix::fromStrings, py::arg("rules"), py::arg("rows"),
+                      py::keep_alive<0, 1>())
+          .def("rows", &RingMatrix::rows)
+          .def("cols", &RingMatrix::cols)
+          .def("at", &RingMatrix::at, py::arg("row"), py::arg("col"))
+          .def("set", &RingMatrix::set, py::arg("row"), py::arg("col"), py::arg("value"))
+          .def("toArray", [](const RingMatrix& mat) {
+                    IndexArray out({static_cast<py::ssize_t>(mat.rows()), static_cast<py::ssize_t>(mat.cols())});
+                    std::copy(mat.getValues().begin(), mat.getValues().end(), out.mutable_data());
+                    return out;
+               })
+          .def("toString", &RingMatrix::toString)
+          .def("__str__", &RingMatrix::toString)
+          .def("__eq__", &RingMatrix::operator==);
+
+     py::class_<MatrixArithmetic>(m, "MatrixArithmetic")
+          .def(py::init<const SmallRingArithmetic&, unsigned>(),
+               py::arg("small"), py::arg("threads") = 0, py::keep_alive<1, 2>())
+          .def("add", &MatrixArithmetic::add)
+          .def("subtract", &MatrixArithmetic::subtract)
+          .def("multiply", &MatrixArithmetic::multiply, py::call_guard<py::gil_scoped_release>())
+          .def("transpose", &MatrixArithmetic::transpose)
+          .def("rowEchelon", &MatrixArithmetic::rowEchelon, py::call_guard<py::gil_scoped_release>())
+          .def("rank", &MatrixArithmetic::rank, py::call_guard<py::gil_scoped_release>())
+          .def("determinant", &MatrixArithmetic::determinant, py::call_guard<py::gil_scoped_release>())
+          .def("inverse", &MatrixArithmetic::inverse, py::call_guard<py::gil_scoped_release>())
+          .def("solve", &MatrixArithmetic::solve, py::call_guard<py::gil_scoped_release>())
+          .def("isField", &MatrixArithmetic::isField);
+
+     // * --- RingStorage ---
+     py::class_<StorageHeader>(m, "StorageHeader")
+          .def_readonly("variant", &StorageHeader::variant)
+          .def_readonly("size", &StorageHeader::size)
+          .def_readonly("bits", &StorageHeader::bits)
+          .def_readonly("alphabet", &StorageHeader::alphabet);
+
+     py::class_<RingStorageWriter>(m, "RingStorageWriter")
+          .def(py::init<const std::string&, const FiniteRingRules&, const std::string&>(),
+               py::arg("path"), py::arg("rules"), py::arg("variant_name"), py::keep_alive<1, 3>())
+          .def("write", &RingStorageWriter::write, py::arg("num"))
+          .def("writeMany", &RingStorageWriter::writeMany, py::arg("nums"))
+          .def("close", &RingStorageWriter::close)
+          .def("count", &RingStorageWriter::count)
+          .def("__enter__", [](RingStorageWriter& w) -> RingStorageWriter& { return w; },
+               py::return_value_policy::reference)
+          .def("__exit__", [](RingStorageWriter& w, py::args) { w.close(); });
+
+     py::class_<RingStorageReader>(m, "RingStorageReader")
+          .def(py::init<const std::string&, const FiniteRingRules&>(),
+               py::arg("path"), py::arg("rules"), py::keep_alive<1, 3>())
+          .def("header", &RingStorageReader::header)
+          .def("readMany", &RingStorageReader::readMany, py::arg("max_count"),
+               py::call_guard<py::gil_scoped_release>())
+          // итератор по записям до конца файла
+          .def("__iter__", [](RingStorageReader& r) -> RingStorageReader& { return r; },
+               py::return_value_policy::reference)
+          .def("__next__", [](RingStorageReader& r) {
+                    RingNumber num(r.getRules());
+                    if (!r.next(num)) {
+                         throw py::stop_iteration();
+                    }
+                    return num;
+               });
+
+     py::class_<MappedRingStorage>(m, "MappedRingStorage")
+          .def(py::init<const std::string&, const FiniteRingRules&>(),
+               py::arg("path"), py::arg("rules"), py::keep_alive<1, 3>())
+          .def("header", &MappedRingStorage::header)
+          .def("size", &MappedRingStorage::size)
+          .def("at", &MappedRingStorage::at, py::arg("index"))
+          .def("__len__", &MappedRingStorage::size)
+          .def("__getitem__", &MappedRingStorage::at);
         
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+// core/src/AxiomVerifier.cc
+#include "AxiomVerifier.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+using std::string;
+using std::vector;
+
+AxiomVerifier::AxiomVerifier(const FiniteRingRules& rules, const BigRingArithmetic& big)
+    : rules_(rules), big_(big) {}
+
+const vector<Axiom>& AxiomVerifier::allAxioms() {
+    static const vector<Axiom> axioms = {
+        Axiom::AddCommutative, Axiom::MulCommutative, Axiom::AddAssociative,
+        Axiom::MulAssociative, Axiom::Distributive, Axiom::Identities,
+        Axiom::DivisionInvariant
+    };
+    return axioms;
+}
+
+string AxiomVerifier::axiomName(Axiom axiom) {
+    switch (axiom) {
+        case Axiom::AddCommutative: return "add_commutative";
+        case Axiom::MulCommutative: return "mul_commutative";
+        case Axiom::AddAssociative: return "add_associative";
+        case Axiom::MulAssociative: return "mul_associative";
+        case Axiom::Distributive: return "distributive";
+        case Axiom::Identities: return "identities";
+        case Axiom::DivisionInvariant: return "division_invariant";
+    }
+    throw std::runtime_error("Unknown axiom");
+}
+
+int AxiomVerifier::arity(Axiom axiom) {
+    switch (axiom) {
+        case Axiom::Identities: return 1;
+        case Axiom::AddCommutative:
+        case Axiom::MulCommutative:
+        case Axiom::DivisionInvariant: return 2;
+        default: return 3;
+    }
+}
+
+// * все числа до max_digits цифр (0 .. N^k - 1), при with_signs - и отрицательные
+vector<RingNumber> AxiomVerifier::operandSpace(const VerifierOptions& options) const {
+    if (options.max_digits == 0) {
+        throw std::runtime_error("Verifier: max_digits must be positive");
+    }
+    const uint64_t base = static_cast<uint64_t>(rules_.getSize());
+    uint64_t count = 1;
+    for (size_t i = 0; i < options.max_digits; ++i) {
+        if (count > (uint64_t(1) << 24) / base) {
+            throw std::runtime_error("Verifier: operand space too large for " +
+                                     std::to_string(options.max_digits) + " digits");
+        }
+        count *= base;
+    }
+
+    vector<RingNumber> operands;
+    operands.reserve(options.with_signs ? 2 * count - 1 : count);
+    vector<uint8_t> digits(options.max_digits);
+    for (uint64_t value = 0; value < count; ++value) {
+        uint64_t rest = value;
+        for (auto& d : digits) {
+            d = static_cast<uint8_t>(rest % base);
+            rest /= base;
+        }
+        operands.emplace_back(rules_, digits);
+        operands.back().normalize();
+    }
+    if (options.with_signs) {
+        for (uint64_t value = 1; value < count; ++value) {
+            operands.push_back(big_.negate(operands[value]));
+        }
+    }
+    return operands;
+}
+
+vector<AxiomReport> AxiomVerifier::run(const VerifierOptions& options) const {
+    const vector<RingNumber> operands = operandSpace(options);
+    const vector<Axiom>& axioms = options.axioms.empty() ? allAxioms() : options.axioms;
+    const uint64_t space = operands.size();
+
+    // * размеры пространств по аксиомам и общий объём для прогресса
+    vector<uint64_t> totals;
+    uint64_t grand_total = 0;
+    for (Axiom axiom : axioms) {
+        uint64_t total = 1;
+        for (int i = 0; i < arity(axiom); ++i) {
+            if (total > std::numeric_limits<uint64_t>::max() / space) {
+                throw std::runtime_error("Verifier: too many operand tuples for " + axiomName(axiom));
+            }
+            total *= space;
+        }
+        totals.push_back(total);
+        grand_total += total;
+    }
+
+    WorkStealingPool pool(options.threads);
+    std::atomic<uint64_t> done{0};
+    auto report_progress = [&] {
+        if (options.progress) {
+            options.progress(done.load(std::memory_order_relaxed), grand_total);
+        }
+    };
+
+    vector<AxiomReport> reports;
+    for (size_t a = 0; a < axioms.size(); ++a) {
+        AxiomReport report;
+        report.axiom = axioms[a];
+        report.total = totals[a];
+        const int n = arity(axioms[a]);
+
+        std::atomic<uint64_t> checked{0};
+        std::mutex failure_mutex;
+
+        // диапазон индексов наборов: индекс - число в системе по основанию |операндов|
+        auto body = [&](uint64_t begin, uint64_t end) {
+            RingNumber values[3] = {RingNumber(rules_), RingNumber(rules_), RingNumber(rules_)};
+            for (uint64_t index = begin; index < end; ++index) {
+                uint64_t rest = index;
+                for (int i = 0; i < n; ++i) {
+                    values[i] = operands[rest % space];
+                    rest /= space;
+                }
+                string failure = check(axioms[a], values);
+                if (!failure.empty()) {
+                    checked.fetch_add(index - begin + 1);
+                    done.fetch_add(index - begin + 1);
+                    std::lock_guard<std::mutex> lock(failure_mutex);
+                    if (report.passed) {
+                        report.passed = false;
+                        report.operands.assign(values, values + n);
+                        report.message = failure;
+                    }
+                    return false;
+                }
+            }
+            checked.fetch_add(end - begin);
+            done.fetch_add(end - begin);
+            return true;
+        };
+
+        // ~64 диапазона на поток: хватает на кражу, накладные расходы малы.
+        // потолок 65536 - чтобы прогресс и ранний выход не ждали длинный диапазон;
+        // пул делит блоки лениво, так что мелкий grain памяти не стоит
+        const uint64_t grain = std::clamp<uint64_t>(totals[a] / (64 * pool.size()), 64, 1 << 16);
+        pool.parallelFor(totals[a], grain, body, report_progress);
+
+        report.checked = checked.load();
+        reports.push_back(std::move(report));
+        report_progress();
+        if (!reports.back().passed) {
+            break;
+        }
+    }
+    return reports;
+}
+
+string AxiomVerifier::check(Axiom axiom, const RingNumber* v) const {
+    const BigRingArithmetic& big = big_;
+    switch (axiom) {
+        case Axiom::AddCommutative:
+            return big.add(v[0], v[1]) == big.add(v[1], v[0]) ? "" : "a + b != b + a";
+        case Axiom::MulCommutative:
+            return big.multiply(v[0], v[1]) == big.multiply(v[1], v[0]) ? "" : "a * b != b * a";
+        case Axiom::AddAssociative:
+            return big.add(big.add(v[0], v[1]), v[2]) == big.add(v[0], big.add(v[1], v[2]))
+                       ? "" : "(a + b) + c != a + (b + c)";
+        case Axiom::MulAssociative:
+            return big.multiply(big.multiply(v[0], v[1]), v[2]) == big.multiply(v[0], big.multiply(v[1], v[2]))
+                       ? "" : "(a * b) * c != a * (b * c)";
+        case Axiom::Distributive:
+            return big.multiply(v[0], big.add(v[1], v[2])) ==
+                           big.add(big.multiply(v[0], v[1]), big.multiply(v[0], v[2]))
+                       ? "" : "a * (b + c) != a * b + a * c";
+        case Axiom::Identities: {
+            const RingNumber zero(rules_);
+            const RingNumber one(rules_, DigitBuffer{1});
+            if (big.add(v[0], zero) != v[0]) return "a + 0 != a";
+            if (big.multiply(v[0], one) != v[0]) return "a * 1 != a";
+            if (!big.subtract(v[0], v[0]).isZero()) return "a - a != 0";
+            if (big.negate(big.negate(v[0])) != v[0]) return "-(-a) != a";
+            return "";
+        }
+        case Axiom::DivisionInvariant: {
+            if (v[1].isZero()) {
+                return "";
+            }
+            DivisionResult qr = big.divide(v[0], v[1]);
+            if (qr.remainder.isNegative() || !big.subtract(qr.remainder, v[1].withoutSign()).isNegative()) {
+                return "remainder out of [0, |b|): " + qr.toString();
+            }
+            if (big.add(big.multiply(v[1], qr.quotient), qr.remainder) != v[0]) {
+                return "a != b * q + r: " + qr.toString();
+            }
+            return "";
+        }
+    }
+    throw std::runtime_error("Unknown axiom");
+}
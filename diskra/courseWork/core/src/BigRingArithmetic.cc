@@ -1,5 +1,6 @@
 // core/src/BigRingArithmetic.cc
 #include "BigRingArithmetic.h"
+#include "Convolution.h"
 #include <stdexcept>
 #include <algorithm>
 #include <iostream>
@@ -25,77 +26,73 @@ RingNumber BigRingArithmetic::add(const RingNumber& a, const RingNumber& b) cons
     DEBUG_LOG("  a = " << a.toString() << " (neg=" << a.isNegative() << ", len=" << a.length() << ")");
     DEBUG_LOG("  b = " << b.toString() << " (neg=" << b.isNegative() << ", len=" << b.length() << ")");
     
+    // быстрый путь: |a| + |b| < 2^63 при длинах до k - 1 цифр
+    const size_t native_add_digits = static_cast<size_t>(rules_.getDigitsPerLimb()) - 1;
+    if (fitsNative(a, native_add_digits) && fitsNative(b, native_add_digits)) {
+        return fromNative(toNative(a) + toNative(b));
+    }
+
     bool same_sign = (a.isNegative() == b.isNegative());
     DEBUG_LOG("  same_sign = " << same_sign);
 
-    RingNumber uns_a = a.withoutSign();
-    RingNumber uns_b = b.withoutSign();
+    // модули смотрим через окна, без копий операндов
+    const DigitView mag_a = a.getValues();
+    const DigitView mag_b = b.getValues();
 
     if (same_sign) {
         DEBUG_LOG("  Branch: same sign -> addUnsigned");
-        RingNumber sum = addUnsigned(uns_a, uns_b);
+        RingNumber sum = addUnsigned(mag_a, mag_b);
         sum.setNegative(a.isNegative());
         DEBUG_LOG("  result = " << sum.toString());
         DEBUG_LOG("=== ADD END ===");
         return sum;
     }
 
-    if (isGreaterOrEqual(uns_a, uns_b)) {
-        DEBUG_LOG("  Branch: |a| >= |b| -> subtractPositional(a, b)");
-        RingNumber diff = subtractPositional(uns_a, uns_b);
+    if (isGreaterOrEqual(mag_a, mag_b)) {
+        DEBUG_LOG("  Branch: |a| >= |b| -> subtractUnsigned(a, b)");
+        RingNumber diff = subtractUnsigned(mag_a, mag_b);
         diff.setNegative(a.isNegative());
         DEBUG_LOG("  result = " << diff.toString());
         DEBUG_LOG("=== ADD END ===");
         return diff;
     }
 
-    DEBUG_LOG("  Branch: |a| < |b| -> subtractPositional(b, a)");
-    RingNumber diff = subtractPositional(uns_b, uns_a);
+    DEBUG_LOG("  Branch: |a| < |b| -> subtractUnsigned(b, a)");
+    RingNumber diff = subtractUnsigned(mag_b, mag_a);
     diff.setNegative(b.isNegative());
     DEBUG_LOG("  result = " << diff.toString());
     DEBUG_LOG("=== ADD END ===");
     return diff;
 }
 
-RingNumber BigRingArithmetic::addUnsigned(const RingNumber& a, const RingNumber& b) const {
-    // тут чисто модульное сложение по разрядам не переводим в числа
-    DEBUG_LOG("  --> addUnsigned: a=" << a.toString() << ", b=" << b.toString());
-    size_t max_len = std::max(a.length(), b.length());
-    DEBUG_LOG("      max_len=" << max_len);
-    
-    std::vector<char> result_digits;
-    result_digits.reserve(max_len + 1);
-    
-    char carry_out = zero_;
-    
-    for (size_t i = 0; i < max_len || carry_out != zero_; ++i) {
-        DEBUG_LOG("      iter " << i << ": carry_in=" << carry_out << ", result.size=" << result_digits.size());
-        char digit_a = a.getDigit(i);
-        char digit_b = b.getDigit(i);
-        DEBUG_LOG("        digit_a=" << digit_a << ", digit_b=" << digit_b);
-        char carry_in = carry_out;
-        
-        char sum_mid = small_.add(digit_a, digit_b);
-        // проверка на перенос из-за переполнения
-        char carry_1 = zero_;
-        if (isLessThan(sum_mid, digit_a)) {
-            carry_1 = one_;
-        }
-        
-        char sum_final = small_.add(sum_mid, carry_in);
-        // проверка на перенос из-за добавления переноса
-        char carry_2 = zero_;
-        if (carry_in != zero_ && isLessThan(sum_final, sum_mid)) {
-            carry_2 = one_;
-        }
-        
-        carry_out = (carry_1 != zero_ || carry_2 != zero_) ? one_ : zero_;
-        DEBUG_LOG("        sum_final=" << sum_final << ", carry_out=" << carry_out);
-        result_digits.push_back(sum_final);
+RingNumber BigRingArithmetic::addUnsigned(DigitView a, DigitView b) const {
+    // сложение по разрядам через таблицу (a, b, перенос) -> (цифра, перенос)
+    DEBUG_LOG("  --> addUnsigned: len_a=" << a.length() << ", len_b=" << b.length());
+    const DigitView longer = a.length() >= b.length() ? a : b;
+    const DigitView shorter = a.length() >= b.length() ? b : a;
+
+    const uint16_t* table = rules_.getCarryTable().data();
+    const size_t n = static_cast<size_t>(rules_.getSize());
+    const size_t carry_stride = n * n;
+
+    DigitBuffer result_digits(longer.length() + 1);
+
+    size_t carry = 0;
+    size_t i = 0;
+    for (; i < shorter.length(); ++i) {
+        uint16_t cell = table[carry * carry_stride + longer[i] * n + shorter[i]];
+        result_digits[i] = static_cast<uint8_t>(cell);
+        carry = cell >> 8;
     }
+    // хвост длинного операнда: складываем с нулём
+    for (; i < longer.length(); ++i) {
+        uint16_t cell = table[carry * carry_stride + longer[i] * n];
+        result_digits[i] = static_cast<uint8_t>(cell);
+        carry = cell >> 8;
+    }
+    result_digits[i] = static_cast<uint8_t>(carry);
 
-    RingNumber result(rules_, result_digits);
-    result.normalize();
+    RingNumber result(rules_, std::move(result_digits));
     DEBUG_LOG("      result: " << result.toString() << ", len=" << result.length());
     DEBUG_LOG("  <-- addUnsigned done");
     return result;
@@ -106,6 +103,12 @@ RingNumber BigRingArithmetic::subtract(const RingNumber& a, const RingNumber& b)
     // вычитаем через прибавление инверсии экономно и без заморочек
     DEBUG_LOG("=== SUBTRACT START ===");
     DEBUG_LOG("  a = " << a.toString() << ", b = " << b.toString());
+
+    const size_t native_add_digits = static_cast<size_t>(rules_.getDigitsPerLimb()) - 1;
+    if (fitsNative(a, native_add_digits) && fitsNative(b, native_add_digits)) {
+        return fromNative(toNative(a) - toNative(b));
+    }
+
     RingNumber neg_b = negate(b);
     DEBUG_LOG("  neg_b = " << neg_b.toString());
     RingNumber result = add(a, neg_b);
@@ -115,80 +118,95 @@ RingNumber BigRingArithmetic::subtract(const RingNumber& a, const RingNumber& b)
 
 // * --- ПОЗИЦИОННОЕ ВЫЧИТАНИЕ (для деления) ---
 RingNumber BigRingArithmetic::subtractPositional(const RingNumber& a, const RingNumber& b) const {
-    // позиционное вычитание
-    DEBUG_LOG("  --> subtractPositional: a=" << a.toString() << ", b=" << b.toString());
-    
-    size_t max_len = std::max(a.length(), b.length());
-    DEBUG_LOG("      max_len=" << max_len);
-    std::vector<char> result_digits;
-    result_digits.reserve(max_len);
-    
-    char borrow = zero_; // заём
-    
-    for (size_t i = 0; i < max_len; ++i) {
-        char digit_a = a.getDigit(i);
-        char digit_b = b.getDigit(i);
-        DEBUG_LOG("      iter " << i << ": digit_a=" << digit_a << ", digit_b=" << digit_b << ", borrow=" << borrow);
-        // учитываем заём
-        bool borrow_out = false;
-
-        if (borrow != zero_) {
-            // нужно занять у следующего разряда
-            bool wrapped = (digit_a == zero_);
-            digit_a = small_.subtract(digit_a, one_);
-            DEBUG_LOG("        after borrow: digit_a=" << digit_a << "; wrapped=" << wrapped);
-            if (wrapped) {
-                // одолжили у следующего разряда, сохраняем этот долг
-                borrow_out = true;
-            }
-        }
-        // проверка необходимости займа
-        bool need_borrow = isLessThan(digit_a, digit_b);
-        char diff = small_.subtract(digit_a, digit_b);
-        DEBUG_LOG("        diff=" << diff << ", need_borrow=" << need_borrow);
+    // знаки не учитываются: вычитаются модули
+    return subtractUnsigned(a.getValues(), b.getValues());
+}
 
-        if (need_borrow) {
-            borrow_out = true;
-        }
-        // сохраняем результат
-        result_digits.push_back(diff);
-        borrow = borrow_out ? one_ : zero_;
+RingNumber BigRingArithmetic::subtractUnsigned(DigitView da, DigitView db) const {
+    // позиционное вычитание через таблицу (a, b, заём) -> (цифра, заём)
+    DEBUG_LOG("  --> subtractUnsigned: len_a=" << da.length() << ", len_b=" << db.length());
+
+    const uint16_t* table = rules_.getBorrowTable().data();
+    const size_t n = static_cast<size_t>(rules_.getSize());
+    const size_t borrow_stride = n * n;
+
+    const size_t max_len = std::max(da.length(), db.length());
+    DigitBuffer result_digits(max_len);
+
+    size_t borrow = 0; // заём
+    for (size_t i = 0; i < max_len; ++i) {
+        size_t digit_a = da.digitAt(i);
+        size_t digit_b = db.digitAt(i);
+        uint16_t cell = table[borrow * borrow_stride + digit_a * n + digit_b];
+        result_digits[i] = static_cast<uint8_t>(cell);
+        borrow = cell >> 8;
     }
 
-    if (borrow != zero_) {
+    if (borrow != 0) {
         DEBUG_LOG("      ERROR: final borrow != zero (negative result)");
         throw std::runtime_error("subtractPositional produced a negative result");
     }
 
-    RingNumber result(rules_, result_digits);
-    result.normalize();
+    RingNumber result(rules_, std::move(result_digits));
     DEBUG_LOG("      result: " << result.toString() << ", len=" << result.length());
-    DEBUG_LOG("  <-- subtractPositional done");
+    DEBUG_LOG("  <-- subtractUnsigned done");
     return result;
 }
 
 // * --- УМНОЖЕНИЕ ---
 RingNumber BigRingArithmetic::multiply(const RingNumber& a, const RingNumber& b) const {
-    // тут столбик умножения по цифрам без перевода в числа
-    RingNumber uns_a = a.withoutSign();
-    RingNumber uns_b = b.withoutSign();
-    
-    if (uns_a.isZero() || uns_b.isZero()) {
+    // свёртка цифр без переносов (школьная или Карацуба по длине),
+    // затем один проход переносов по основанию N
+    if (a.isZero() || b.isZero()) {
         return RingNumber(rules_);
     }
-      
-    RingNumber result(rules_);
-    
-    for (size_t i = 0; i < uns_b.length(); ++i) {
-        char digit_b = uns_b.getDigit(i);
-        RingNumber partial = multiplyByDigit(uns_a, digit_b);
-        partial = shiftLeft(partial, static_cast<int>(i));
-        result = addUnsigned(result, partial);
+
+    // быстрый путь: произведение меньше N^(la + lb) <= N^k <= 2^63
+    const size_t native_digits = static_cast<size_t>(rules_.getDigitsPerLimb());
+    if (a.length() + b.length() <= native_digits) {
+        return fromNative(toNative(a) * toNative(b));
     }
-    
-    bool negative = (a.isNegative() != b.isNegative());
-    result.setNegative(negative);
-    result.normalize();
+
+    const DigitView da = a.getValues();
+    const DigitView db = b.getValues();
+
+    if (da.length() == 1 || db.length() == 1) {
+        DigitView longer = da.length() == 1 ? db : da;
+        uint8_t digit = da.length() == 1 ? da[0] : db[0];
+        RingNumber result = multiplyByDigit(longer, digit);
+        result.setNegative(a.isNegative() != b.isNegative());
+        return result;
+    }
+
+    // один блок на расширенные операнды и коэффициенты свёртки
+    const size_t la = da.length();
+    const size_t lb = db.length();
+    const size_t lc = la + lb - 1;
+    std::vector<int64_t> wide(la + lb + lc);
+    int64_t* wide_a = wide.data();
+    int64_t* wide_b = wide_a + la;
+    int64_t* coefficients = wide_b + lb;
+    std::copy(da.begin(), da.end(), wide_a);
+    std::copy(db.begin(), db.end(), wide_b);
+    convolve(wide_a, la, wide_b, lb, coefficients);
+
+    const int64_t base = rules_.getSize();
+    DigitBuffer result_digits;
+    result_digits.reserve(lc + 1);
+
+    int64_t carry = 0;
+    for (size_t i = 0; i < lc; ++i) {
+        int64_t value = coefficients[i] + carry;
+        result_digits.push_back(static_cast<uint8_t>(value % base));
+        carry = value / base;
+    }
+    while (carry != 0) {
+        result_digits.push_back(static_cast<uint8_t>(carry % base));
+        carry /= base;
+    }
+
+    RingNumber result(rules_, std::move(result_digits));
+    result.setNegative(a.isNegative() != b.isNegative());
     return result;
 }
 
@@ -206,55 +224,44 @@ DivisionResult BigRingArithmetic::divide(const RingNumber& a, const RingNumber&
         throw std::runtime_error("Err: Division by zero! Empty set");
     }
 
-    RingNumber dividend = a.withoutSign();
-    RingNumber divisor = b.withoutSign();
-    RingNumber quotient(rules_);
-    RingNumber remainder = dividend;
-
-    DEBUG_LOG("  dividend (|a|) = " << dividend.toString());
-    DEBUG_LOG("  divisor (|b|) = " << divisor.toString());
-
-    if (isGreaterOrEqual(dividend, divisor)) {
-        int shift_amount = static_cast<int>(dividend.length()) - static_cast<int>(divisor.length());
-        RingNumber shifted_divisor = shiftLeft(divisor, shift_amount);
-        DEBUG_LOG("  shift_amount = " << shift_amount);
-
-        for (int i = shift_amount; i >= 0; --i) {
-            char q_digit = findQuotientDigit(remainder, shifted_divisor);
-            DEBUG_LOG("    position " << i << ": q_digit = " << q_digit);
-
-            if (q_digit != zero_) {
-                RingNumber q_digit_num(rules_, std::string(1, q_digit));
-                RingNumber partial_quotient = shiftLeft(q_digit_num, i);
-                quotient = addUnsigned(quotient, partial_quotient);
-
-                RingNumber subtraction_amount = multiplyByDigit(shifted_divisor, q_digit);
-                remainder = subtractPositional(remainder, subtraction_amount);
-                DEBUG_LOG("    remainder after subtraction: " << remainder.toString());
-            }
+    bool dividend_negative = a.isNegative();
+    bool divisor_negative = b.isNegative();
 
-            if (i > 0) {
-                shifted_divisor = shiftRight(shifted_divisor, 1);
-            }
+    // быстрый путь: оба модуля помещаются в int64, правило знаков то же
+    const size_t native_digits = static_cast<size_t>(rules_.getDigitsPerLimb());
+    if (fitsNative(a, native_digits) && fitsNative(b, native_digits)) {
+        int64_t dividend = toNative(a.withoutSign());
+        int64_t divisor = toNative(b.withoutSign());
+        int64_t q = dividend / divisor;
+        int64_t r = dividend % divisor;
+        if (dividend_negative && !divisor_negative && r != 0) {
+            q += 1;
+            r = divisor - r;
         }
+        return DivisionResult(fromNative(dividend_negative != divisor_negative ? -q : q),
+                              fromNative(r));
     }
 
+    DigitBuffer q_digits;
+    DigitBuffer r_digits;
+    divideMagnitudes(a.getValues(), b.getValues(), q_digits, r_digits);
+
+    RingNumber quotient(rules_, std::move(q_digits));
+    RingNumber remainder(rules_, std::move(r_digits));
+
     remainder.normalize();
     quotient.normalize();
 
     DEBUG_LOG("  Before sign adjustment: q=" << quotient.toString() << ", r=" << remainder.toString());
 
-    bool dividend_negative = a.isNegative();
-    bool divisor_negative = b.isNegative();
-
     DEBUG_LOG("  dividend_negative=" << dividend_negative << ", divisor_negative=" << divisor_negative);
     DEBUG_LOG("  remainder.isZero()=" << remainder.isZero());
 
     if (dividend_negative && !divisor_negative && !remainder.isZero()) {
         DEBUG_LOG("  Applying correction for (-a) / (+b) with non-zero remainder");
-        RingNumber one_num(rules_, std::string(1, one_));
-        quotient = addUnsigned(quotient, one_num);
-        remainder = subtractPositional(divisor, remainder);
+        const uint8_t one = 1;
+        quotient = addUnsigned(quotient.getValues(), DigitView(&one, 1));
+        remainder = subtractUnsigned(b.getValues(), remainder.getValues());
         DEBUG_LOG("  After correction: q=" << quotient.toString() << ", r=" << remainder.toString());
     }
 
@@ -284,89 +291,148 @@ RingNumber BigRingArithmetic::negate(const RingNumber& a) const {
 }
 
 // * --- ВСПОМОГАТЕЛЬНЫЕ МЕТОДЫ ---
-RingNumber BigRingArithmetic::multiplyByDigit(const RingNumber& num, char digit) const {
-    // умножаем на одну цифру через последовательное сложение
-    DEBUG_LOG("  --> multiplyByDigit: num=" << num.toString() << ", digit=" << digit);
+RingNumber BigRingArithmetic::multiplyByDigit(DigitView num, uint8_t digit) const {
+    // умножаем модуль на одну цифру за один проход с переносом
+    DEBUG_LOG("  --> multiplyByDigit: len=" << num.length() << ", digit=" << int(digit));
 
-    if (digit == zero_ || num.isZero()) {
+    if (digit == 0 || num.isZero()) {
         DEBUG_LOG("      result: 0");
         return RingNumber(rules_);
     }
 
-    RingNumber positive = num.withoutSign();
-
-    if (digit == one_) {
-        DEBUG_LOG("      result: " << positive.toString());
-        return positive;
+    if (digit == 1) {
+        return RingNumber(rules_, DigitBuffer(num.data(), num.length()));
     }
 
-    RingNumber result(rules_);
-    char counter = zero_;
-    size_t iterations = 0;
-    size_t base_size = static_cast<size_t>(rules_.getSize());
-
-    while (counter != digit) {
-        result = addUnsigned(result, positive);
-        counter = small_.plusOne(counter);
-        iterations++;
-        
-        if (iterations >= base_size) {
-            throw std::runtime_error("multiplyByDigit: infinite loop detected or invalid digit");
-        }
+    const int base = rules_.getSize();
+    if (digit >= base) {
+        throw std::runtime_error("multiplyByDigit: invalid digit");
     }
 
-    DEBUG_LOG("      result: " << result.toString() << " (" << iterations << " iterations)");
-    DEBUG_LOG("  <-- multiplyByDigit done");
-    return result;
-}
+    DigitBuffer result_digits;
+    result_digits.reserve(num.length() + 1);
 
-RingNumber BigRingArithmetic::shiftLeft(const RingNumber& num, int positions) const {
-    if (positions == 0 || num.isZero()) {
-        return num;
-    }
-    std::vector<char> result_digits;
-    result_digits.reserve(num.length() + positions);
-    // добавляем нули в младшие разряды тупо сдвиг назад
-    for (int i = 0; i < positions; ++i) {
-        result_digits.push_back(zero_);
+    int carry = 0;
+    for (uint8_t d : num) {
+        int value = d * digit + carry;
+        result_digits.push_back(static_cast<uint8_t>(value % base));
+        carry = value / base;
     }
-
-    // копируем цифры числа
-    for (size_t i = 0; i < num.length(); ++i) {
-        result_digits.push_back(num.getDigit(i));
+    if (carry != 0) {
+        result_digits.push_back(static_cast<uint8_t>(carry));
     }
 
-    RingNumber result(rules_, result_digits);
-    result.setNegative(num.isNegative());
+    RingNumber result(rules_, std::move(result_digits));
+    DEBUG_LOG("      result: " << result.toString());
+    DEBUG_LOG("  <-- multiplyByDigit done");
     return result;
 }
 
-RingNumber BigRingArithmetic::shiftRight(const RingNumber& num, int positions) const {
-    if (positions <= 0 || num.isZero() || positions >= num.length()) {
-        return RingNumber(rules_); // возвращаем ноль
+// * --- ДЕЛЕНИЕ МОДУЛЕЙ (алгоритм D Кнута) ---
+// оценка цифры частного по старшим цифрам остатка и делителя:
+// q = (u2*N + u1) / v1, затем поправка по второй цифре делителя;
+// после неё оценка больше истинной цифры не более чем на единицу
+uint32_t BigRingArithmetic::estimateQuotientDigit(uint32_t u2, uint32_t u1, uint32_t u0,
+                                                  uint32_t v1, uint32_t v0) const {
+    const uint32_t base = static_cast<uint32_t>(rules_.getSize());
+    uint32_t numerator = u2 * base + u1;
+    uint32_t qhat = numerator / v1;
+    uint32_t rhat = numerator % v1;
+
+    while (qhat >= base || qhat * v0 > rhat * base + u0) {
+        qhat--;
+        rhat += v1;
+        if (rhat >= base) {
+            break;
+        }
     }
+    return qhat;
+}
 
-    std::vector<char> original_digits = num.toVector();
-    std::vector<char> result_digits;
-    
-    // копируем цифры, начиная с positions (отбрасывая младшие разряды)
-    for (size_t i = positions; i < original_digits.size(); ++i) {
-        result_digits.push_back(original_digits[i]);
+void BigRingArithmetic::divideMagnitudes(DigitView u, DigitView v,
+                                         DigitBuffer& quotient,
+                                         DigitBuffer& remainder) const {
+    const int base = rules_.getSize();
+    const size_t n = v.length();
+
+    if (u.length() < n) {
+        quotient.assign(1, 0);
+        remainder.assign(u.data(), u.length());
+        return;
     }
 
-    RingNumber result(rules_, result_digits);
-    result.setNegative(num.isNegative());
-    result.normalize(); 
-    return result;
-}
+    const size_t m = u.length() - n;
+    quotient.assign(m + 1, 0);
+
+    // * короткое деление на одну цифру
+    if (n == 1) {
+        int divisor = v[0];
+        int rem = 0;
+        for (size_t i = u.length(); i > 0; --i) {
+            int current = rem * base + u[i - 1];
+            quotient[i - 1] = static_cast<uint8_t>(current / divisor);
+            rem = current % divisor;
+        }
+        remainder.assign(1, static_cast<uint8_t>(rem));
+        return;
+    }
 
-char BigRingArithmetic::findQuotientDigit(const RingNumber& remainder, const RingNumber& shifted_divisor) const {
+    // * D1: нормализация, старшая цифра делителя >= N/2
+    const int d = base / (v[n - 1] + 1);
+    DigitBuffer un(u.length() + 1);
+    DigitBuffer vn(n);
+    int carry = 0;
+    for (size_t i = 0; i < n; ++i) {
+        int value = v[i] * d + carry;
+        vn[i] = static_cast<uint8_t>(value % base);
+        carry = value / base;
+    }
+    carry = 0;
+    for (size_t i = 0; i < u.length(); ++i) {
+        int value = u[i] * d + carry;
+        un[i] = static_cast<uint8_t>(value % base);
+        carry = value / base;
+    }
+    un[u.length()] = static_cast<uint8_t>(carry);
+
+    // * D2-D7: по цифре частного от старшей позиции к младшей
+    for (size_t j = m + 1; j-- > 0;) {
+        uint32_t qhat = estimateQuotientDigit(un[j + n], un[j + n - 1], un[j + n - 2],
+                                              vn[n - 1], vn[n - 2]);
+
+        // un[j .. j+n] -= qhat * vn
+        int borrow = 0;
+        int mul_carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            int product = static_cast<int>(qhat) * vn[i] + mul_carry;
+            mul_carry = product / base;
+            int diff = un[i + j] - product % base - borrow;
+            borrow = diff < 0 ? 1 : 0;
+            un[i + j] = static_cast<uint8_t>(diff + borrow * base);
+        }
+        int top = un[j + n] - mul_carry - borrow;
+
+        // оценка оказалась на единицу больше: возвращаем делитель обратно
+        if (top < 0) {
+            qhat--;
+            int add_carry = 0;
+            for (size_t i = 0; i < n; ++i) {
+                int sum = un[i + j] + vn[i] + add_carry;
+                add_carry = sum >= base ? 1 : 0;
+                un[i + j] = static_cast<uint8_t>(sum - add_carry * base);
+            }
+            top += add_carry;
+        }
+        un[j + n] = static_cast<uint8_t>(top + (top < 0 ? base : 0));
+        quotient[j] = static_cast<uint8_t>(qhat);
+    }
 
-    char q_digit = zero_;
-    RingNumber temp_remainder = remainder;
-    while (isGreaterOrEqual(temp_remainder, shifted_divisor)) {
-        temp_remainder = subtractPositional(temp_remainder, shifted_divisor);
-        q_digit = small_.plusOne(q_digit);
+    // * D8: денормализация остатка (деление на d)
+    remainder.assign(n, 0);
+    int rem = 0;
+    for (size_t i = n; i > 0; --i) {
+        int current = rem * base + un[i - 1];
+        remainder[i - 1] = static_cast<uint8_t>(current / d);
+        rem = current % d;
     }
-    return q_digit;
-}
\ No newline at end of file
+}
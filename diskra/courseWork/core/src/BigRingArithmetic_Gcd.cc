@@ -0,0 +1,167 @@
+// core/src/BigRingArithmetic_Gcd.cc
+#include "BigRingArithmetic.h"
+#include <stdexcept>
+#include <utility>
+
+// * --- НОД (алгоритм Лемера, Кнут 4.5.2 L) ---
+// шаг Евклида ведётся по старшим цифрам обоих чисел в int64 и копит
+// матрицу [A B; C D], пока частные по приближениям совпадают с точными;
+// к длинным числам матрица применяется разом. Если ни одного частного
+// угадать не удалось (B = 0), делается полный шаг через divideMagnitudes -
+// то же деление столбиком с оценкой цифры частного, что и в divide.
+// Когда a помещается в int64, остаток алгоритма идёт в машинных целых.
+
+RingNumber BigRingArithmetic::gcd(const RingNumber& a, const RingNumber& b) const {
+    RingNumber ma = a.withoutSign();
+    RingNumber mb = b.withoutSign();
+    if (!isGreaterOrEqual(ma.getValues(), mb.getValues())) {
+        std::swap(ma, mb);
+    }
+    return lehmerGcd(std::move(ma), std::move(mb), nullptr);
+}
+
+GcdResult BigRingArithmetic::extendedGcd(const RingNumber& a, const RingNumber& b) const {
+    RingNumber u = a.withoutSign();
+    RingNumber v = b.withoutSign();
+    const bool swapped = !isGreaterOrEqual(u.getValues(), v.getValues());
+    if (swapped) {
+        std::swap(u, v);
+    }
+
+    // s*u + t*v = g; t восстанавливается точным делением
+    RingNumber s(rules_);
+    RingNumber g = lehmerGcd(u, v, &s);
+    RingNumber t(rules_);
+    if (!v.isZero()) {
+        t = divide(subtract(g, multiply(s, u)), v).quotient;
+    }
+
+    RingNumber x = swapped ? t : s;
+    RingNumber y = swapped ? s : t;
+    if (a.isNegative()) {
+        x = negate(x);
+    }
+    if (b.isNegative()) {
+        y = negate(y);
+    }
+    return GcdResult(std::move(g), std::move(x), std::move(y));
+}
+
+RingNumber BigRingArithmetic::modInverse(const RingNumber& a, const RingNumber& m) const {
+    if (m.isZero()) {
+        throw std::runtime_error("Division by zero");
+    }
+
+    // остаток деления всегда в [0, |m|)
+    const RingNumber modulus = m.withoutSign();
+    GcdResult bezout = extendedGcd(divide(a, modulus).remainder, modulus);
+    if (bezout.gcd != RingNumber(rules_, DigitBuffer{1})) {
+        throw std::runtime_error("No multiplicative inverse for element: " + a.toString() +
+                                 " modulo " + m.toString());
+    }
+    return divide(bezout.x, modulus).remainder;
+}
+
+RingNumber BigRingArithmetic::lehmerGcd(RingNumber a, RingNumber b, RingNumber* cofactor) const {
+    const size_t native_digits = static_cast<size_t>(rules_.getDigitsPerLimb());
+    // на цифру короче: a^ + A и b^ + D не переполняют int64
+    const size_t lead_digits = native_digits - 1;
+
+    // a = x0 * a_исх (mod b_исх), b = x1 * a_исх (mod b_исх)
+    RingNumber x0(rules_, DigitBuffer{1});
+    RingNumber x1(rules_);
+
+    while (!b.isZero()) {
+        // * хвост в машинных целых
+        if (a.length() <= native_digits) {
+            int64_t u = toNative(a), v = toNative(b);
+            int64_t s0 = 1, s1 = 0, t0 = 0, t1 = 1;
+            while (v != 0) {
+                int64_t q = u / v;
+                int64_t next = u - q * v;
+                u = v;
+                v = next;
+                next = s0 - q * s1;
+                s0 = s1;
+                s1 = next;
+                next = t0 - q * t1;
+                t0 = t1;
+                t1 = next;
+            }
+            if (cofactor != nullptr) {
+                *cofactor = add(multiply(x0, fromNative(s0)), multiply(x1, fromNative(t0)));
+            }
+            return fromNative(u);
+        }
+
+        // * шаг Лемера по старшим цифрам
+        const size_t shift = a.length() - lead_digits;
+        int64_t a_hat = leadingNative(a.getValues(), shift);
+        int64_t b_hat = leadingNative(b.getValues(), shift);
+        int64_t A = 1, B = 0, C = 0, D = 1;
+        while (b_hat + C != 0 && b_hat + D != 0) {
+            int64_t q = (a_hat + A) / (b_hat + C);
+            if (q != (a_hat + B) / (b_hat + D)) {
+                break;
+            }
+            int64_t next = A - q * C;
+            A = C;
+            C = next;
+            next = B - q * D;
+            B = D;
+            D = next;
+            next = a_hat - q * b_hat;
+            a_hat = b_hat;
+            b_hat = next;
+        }
+
+        if (B == 0) {
+            // * полный шаг: (a, b) <- (b, a mod b)
+            DigitBuffer q_digits;
+            DigitBuffer r_digits;
+            divideMagnitudes(a.getValues(), b.getValues(), q_digits, r_digits);
+            RingNumber remainder(rules_, std::move(r_digits));
+            remainder.normalize();
+            a = std::move(b);
+            b = std::move(remainder);
+
+            if (cofactor != nullptr) {
+                RingNumber quotient(rules_, std::move(q_digits));
+                quotient.normalize();
+                RingNumber next = subtract(x0, multiply(quotient, x1));
+                x0 = std::move(x1);
+                x1 = std::move(next);
+            }
+            continue;
+        }
+
+        // * матрица шага к длинным числам (результаты неотрицательны)
+        const RingNumber mA = fromNative(A), mB = fromNative(B);
+        const RingNumber mC = fromNative(C), mD = fromNative(D);
+        RingNumber next_a = add(multiply(a, mA), multiply(b, mB));
+        RingNumber next_b = add(multiply(a, mC), multiply(b, mD));
+        a = std::move(next_a);
+        b = std::move(next_b);
+
+        if (cofactor != nullptr) {
+            RingNumber next_x0 = add(multiply(x0, mA), multiply(x1, mB));
+            RingNumber next_x1 = add(multiply(x0, mC), multiply(x1, mD));
+            x0 = std::move(next_x0);
+            x1 = std::move(next_x1);
+        }
+    }
+
+    if (cofactor != nullptr) {
+        *cofactor = std::move(x0);
+    }
+    return a;
+}
+
+int64_t BigRingArithmetic::leadingNative(DigitView num, size_t shift) const {
+    const int64_t base = rules_.getSize();
+    int64_t value = 0;
+    for (size_t i = num.length(); i > shift; --i) {
+        value = value * base + num[i - 1];
+    }
+    return value;
+}
@@ -0,0 +1,102 @@
+// core/src/BigRingArithmetic_Packed.cc
+#include "BigRingArithmetic.h"
+#include <stdexcept>
+#include <algorithm>
+
+using std::vector;
+
+// * --- УПАКОВАННЫЙ РЕЖИМ ---
+// знак и модуль как у RingNumber, модуль - вектор limb'ов по основанию N^k;
+// любой limb < N^k <= 2^63, так что a + b + 1 помещается в uint64_t
+
+PackedRingNumber BigRingArithmetic::add(const PackedRingNumber& a, const PackedRingNumber& b) const {
+    const vector<uint64_t>& la = a.getLimbs();
+    const vector<uint64_t>& lb = b.getLimbs();
+
+    if (a.isNegative() == b.isNegative()) {
+        return PackedRingNumber(rules_, addLimbs(la, lb), a.isNegative());
+    }
+
+    // знаки разные: из большего модуля вычитаем меньший
+    if (compareLimbs(la, lb) >= 0) {
+        return PackedRingNumber(rules_, subtractLimbs(la, lb), a.isNegative());
+    }
+    return PackedRingNumber(rules_, subtractLimbs(lb, la), b.isNegative());
+}
+
+PackedRingNumber BigRingArithmetic::subtract(const PackedRingNumber& a, const PackedRingNumber& b) const {
+    return add(a, negate(b));
+}
+
+PackedRingNumber BigRingArithmetic::negate(const PackedRingNumber& a) const {
+    PackedRingNumber result = a;
+    result.setNegative(!a.isNegative());
+    return result;
+}
+
+int BigRingArithmetic::compare(const PackedRingNumber& a, const PackedRingNumber& b) const {
+    if (a.isNegative() != b.isNegative()) {
+        return a.isNegative() ? -1 : 1;
+    }
+    int magnitude = compareLimbs(a.getLimbs(), b.getLimbs());
+    return a.isNegative() ? -magnitude : magnitude;
+}
+
+// * --- ОПЕРАЦИИ НАД МОДУЛЯМИ ---
+vector<uint64_t> BigRingArithmetic::addLimbs(const vector<uint64_t>& a, const vector<uint64_t>& b) const {
+    const uint64_t base = rules_.getLimbBase();
+    const vector<uint64_t>& longer = a.size() >= b.size() ? a : b;
+    const vector<uint64_t>& shorter = a.size() >= b.size() ? b : a;
+
+    vector<uint64_t> result;
+    result.reserve(longer.size() + 1);
+
+    uint64_t carry = 0;
+    for (size_t i = 0; i < longer.size(); ++i) {
+        uint64_t sum = longer[i] + (i < shorter.size() ? shorter[i] : 0) + carry;
+        carry = (sum >= base) ? 1 : 0;
+        result.push_back(sum - carry * base);
+    }
+    if (carry != 0) {
+        result.push_back(carry);
+    }
+    return result;
+}
+
+// ! требует |a| >= |b|
+vector<uint64_t> BigRingArithmetic::subtractLimbs(const vector<uint64_t>& a, const vector<uint64_t>& b) const {
+    const uint64_t base = rules_.getLimbBase();
+
+    vector<uint64_t> result;
+    result.reserve(a.size());
+
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        uint64_t subtrahend = (i < b.size() ? b[i] : 0) + borrow;
+        borrow = (a[i] < subtrahend) ? 1 : 0;
+        result.push_back(a[i] + borrow * base - subtrahend);
+    }
+
+    if (borrow != 0) {
+        throw std::runtime_error("subtractLimbs produced a negative result");
+    }
+    return result;
+}
+
+int BigRingArithmetic::compareLimbs(const vector<uint64_t>& a, const vector<uint64_t>& b) const {
+    // старшие нулевые limb'ы не учитываем
+    size_t len_a = a.size();
+    size_t len_b = b.size();
+    while (len_a > 1 && a[len_a - 1] == 0) --len_a;
+    while (len_b > 1 && b[len_b - 1] == 0) --len_b;
+
+    if (len_a != len_b) {
+        return len_a > len_b ? 1 : -1;
+    }
+    for (size_t i = len_a; i > 0; --i) {
+        if (a[i - 1] != b[i - 1]) {
+            return a[i - 1] > b[i - 1] ? 1 : -1;
+        }
+    }
+    return 0;
+}
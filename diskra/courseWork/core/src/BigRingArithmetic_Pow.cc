@@ -0,0 +1,141 @@
+// core/src/BigRingArithmetic_Pow.cc
+#include "BigRingArithmetic.h"
+#include <stdexcept>
+#include <algorithm>
+
+using std::vector;
+
+// * --- ВОЗВЕДЕНИЕ В СТЕПЕНЬ ---
+// слева направо по битам показателя окнами до w бит, окно всегда
+// заканчивается единицей: заранее считаются только нечётные степени
+// base^1, base^3, ..., base^(2^w - 1); умножения идут через multiply,
+// так что короткие операнды попадают в быстрый путь через int64
+
+RingNumber BigRingArithmetic::pow(const RingNumber& base, uint64_t exponent) const {
+    return powBits(base, exponentBits(exponent), 0);
+}
+
+RingNumber BigRingArithmetic::pow(const RingNumber& base, const RingNumber& exponent) const {
+    return powBits(base, exponentBits(exponent), 0);
+}
+
+RingNumber BigRingArithmetic::powFixed(const RingNumber& base, uint64_t exponent) const {
+    return powBits(base, exponentBits(exponent), MAX_DIGITS);
+}
+
+RingNumber BigRingArithmetic::powFixed(const RingNumber& base, const RingNumber& exponent) const {
+    return powBits(base, exponentBits(exponent), MAX_DIGITS);
+}
+
+RingNumber BigRingArithmetic::powBits(const RingNumber& base, const vector<uint8_t>& bits,
+                                      size_t keep_digits) const {
+    // произведение с обрезкой (если задана): модуль по N^keep_digits
+    auto mul = [&](const RingNumber& a, const RingNumber& b) {
+        RingNumber product = multiply(a, b);
+        return keep_digits == 0 ? product : truncate(product, keep_digits);
+    };
+
+    const size_t n = bits.size();
+    if (n == 0) {
+        return RingNumber(rules_, DigitBuffer{1});
+    }
+
+    // ширина окна по длине показателя
+    const size_t width = n < 8 ? 1 : n < 24 ? 3 : n < 80 ? 4 : n < 240 ? 5 : 6;
+
+    // odd[i] = base^(2i + 1)
+    vector<RingNumber> odd;
+    odd.reserve(size_t(1) << (width - 1));
+    odd.push_back(keep_digits == 0 ? base : truncate(base, keep_digits));
+    if (width > 1) {
+        const RingNumber square = mul(odd[0], odd[0]);
+        for (size_t i = 1; i < (size_t(1) << (width - 1)); ++i) {
+            odd.push_back(mul(odd[i - 1], square));
+        }
+    }
+
+    // старший бит показателя всегда 1, с него и начинаем
+    RingNumber result(rules_);
+    bool started = false;
+    size_t i = 0;
+    while (i < n) {
+        if (bits[i] == 0) {
+            result = mul(result, result);
+            ++i;
+            continue;
+        }
+
+        // самое длинное окно [i, j] не шире width, заканчивающееся единицей
+        size_t j = std::min(i + width, n) - 1;
+        while (bits[j] == 0) {
+            --j;
+        }
+        size_t window = 0;
+        for (size_t k = i; k <= j; ++k) {
+            window = (window << 1) | bits[k];
+        }
+
+        if (started) {
+            for (size_t k = i; k <= j; ++k) {
+                result = mul(result, result);
+            }
+            result = mul(result, odd[window >> 1]);
+        } else {
+            result = odd[window >> 1];
+            started = true;
+        }
+        i = j + 1;
+    }
+    return result;
+}
+
+// * биты показателя, старший первым (для нуля - пустой вектор)
+vector<uint8_t> BigRingArithmetic::exponentBits(uint64_t exponent) const {
+    vector<uint8_t> bits;
+    for (int b = 63; b >= 0; --b) {
+        if (!bits.empty() || ((exponent >> b) & 1) != 0) {
+            bits.push_back(static_cast<uint8_t>((exponent >> b) & 1));
+        }
+    }
+    return bits;
+}
+
+vector<uint8_t> BigRingArithmetic::exponentBits(const RingNumber& exponent) const {
+    if (exponent.isNegative()) {
+        throw std::runtime_error("Negative exponent is not supported");
+    }
+
+    // делим цифры по основанию N на 2, пока не останется ноль; остатки - биты
+    const int base = rules_.getSize();
+    const DigitBuffer& value = exponent.getValues();
+    vector<uint8_t> digits(value.begin(), value.end());
+    size_t len = digits.size();
+    while (len > 0 && digits[len - 1] == 0) {
+        --len;
+    }
+
+    vector<uint8_t> bits;
+    while (len > 0) {
+        int rem = 0;
+        for (size_t i = len; i > 0; --i) {
+            int current = rem * base + digits[i - 1];
+            digits[i - 1] = static_cast<uint8_t>(current / 2);
+            rem = current % 2;
+        }
+        bits.push_back(static_cast<uint8_t>(rem));
+        while (len > 0 && digits[len - 1] == 0) {
+            --len;
+        }
+    }
+    std::reverse(bits.begin(), bits.end());
+    return bits;
+}
+
+// * младшие digits разрядов модуля, знак сохраняется (у нуля - сбрасывается)
+RingNumber BigRingArithmetic::truncate(const RingNumber& num, size_t digits) const {
+    if (num.length() <= digits) {
+        return num;
+    }
+    const DigitView low = DigitView(num.getValues()).window(0, digits);
+    return RingNumber(rules_, DigitBuffer(low.data(), low.length()), num.isNegative());
+}
@@ -0,0 +1,100 @@
+// core/src/Convolution.cc
+#include "Convolution.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// * школьное умножение: out[0 .. na+nb-1) перезаписывается
+void convolveSchoolbook(const int64_t* a, size_t na, const int64_t* b, size_t nb, int64_t* out) {
+    std::fill(out, out + na + nb - 1, 0);
+    for (size_t i = 0; i < na; ++i) {
+        const int64_t ai = a[i];
+        if (ai == 0) {
+            continue;
+        }
+        for (size_t j = 0; j < nb; ++j) {
+            out[i + j] += ai * b[j];
+        }
+    }
+}
+
+// * Карацуба для операндов одинаковой длины n
+// out: 2n - 1 ячеек, scratch: не меньше scratchSize(n)
+void karatsuba(const int64_t* a, const int64_t* b, size_t n, int64_t* out, int64_t* scratch) {
+    if (n < KARATSUBA_THRESHOLD) {
+        convolveSchoolbook(a, n, b, n, out);
+        return;
+    }
+
+    // a = a0 + a1 * x^h, длина a0 = h, длина a1 = l <= h
+    const size_t h = (n + 1) / 2;
+    const size_t l = n - h;
+
+    // z0 = a0 * b0 -> out[0 .. 2h-1), z2 = a1 * b1 -> out[2h .. 2n-1)
+    karatsuba(a, b, h, out, scratch);
+    out[2 * h - 1] = 0;
+    karatsuba(a + h, b + h, l, out + 2 * h, scratch);
+
+    // da = a0 - a1, db = b0 - b1 (a1, b1 дополнены нулями до h)
+    int64_t* da = scratch;
+    int64_t* db = da + h;
+    int64_t* z1 = db + h;
+    for (size_t i = 0; i < h; ++i) {
+        da[i] = a[i] - (i < l ? a[h + i] : 0);
+        db[i] = b[i] - (i < l ? b[h + i] : 0);
+    }
+    karatsuba(da, db, h, z1, z1 + 2 * h - 1);
+
+    // середина: z0 + z2 - (a0 - a1)(b0 - b1), считаем до записи в out
+    const size_t z2_len = 2 * l - 1;
+    for (size_t i = 0; i < 2 * h - 1; ++i) {
+        z1[i] = out[i] + (i < z2_len ? out[2 * h + i] : 0) - z1[i];
+    }
+    for (size_t i = 0; i < 2 * h - 1; ++i) {
+        out[h + i] += z1[i];
+    }
+}
+
+// место под da, db, z1 на каждом уровне рекурсии
+size_t scratchSize(size_t n) {
+    size_t total = 0;
+    while (n >= KARATSUBA_THRESHOLD) {
+        size_t h = (n + 1) / 2;
+        total += 4 * h - 1;
+        n = h;
+    }
+    return total + 1;
+}
+
+}  // namespace
+
+void convolve(const int64_t* a, size_t na, const int64_t* b, size_t nb, int64_t* out) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb < KARATSUBA_THRESHOLD) {
+        convolveSchoolbook(a, na, b, nb, out);
+        return;
+    }
+
+    // длинный операнд режем на куски длины nb, каждый кусок - Карацуба
+    std::vector<int64_t> scratch(scratchSize(nb));
+    std::vector<int64_t> chunk_a(nb);
+    std::vector<int64_t> partial(2 * nb - 1);
+
+    std::fill(out, out + na + nb - 1, 0);
+    for (size_t start = 0; start < na; start += nb) {
+        size_t len = std::min(nb, na - start);
+        std::copy(a + start, a + start + len, chunk_a.begin());
+        std::fill(chunk_a.begin() + len, chunk_a.end(), 0);
+
+        karatsuba(chunk_a.data(), b, nb, partial.data(), scratch.data());
+
+        size_t limit = std::min(partial.size(), na + nb - 1 - start);
+        for (size_t i = 0; i < limit; ++i) {
+            out[start + i] += partial[i];
+        }
+    }
+}
@@ -7,7 +7,6 @@
 
 using std::string;
 using std::vector;
-using std::map;
 using std::runtime_error;
 using std::cerr;
 using std::endl;
@@ -45,6 +44,10 @@ FiniteRingRules::FiniteRingRules(const string& config_file,
     }
 }
 
+FiniteRingRules::FiniteRingRules(const YAML::Node& variant_node) {
+    init(variant_node);
+}
+
 void FiniteRingRules::init(const YAML::Node& variant_node) {
     // * 1 --- чтение базовых параметров
     if (!variant_node["size"] || !variant_node["zero_element"] || !variant_node["one_element"]) {
@@ -52,6 +55,9 @@ void FiniteRingRules::init(const YAML::Node& variant_node) {
     }
     
     size_ = variant_node["size"].as<int>();    
+    if (size_ < 2 || size_ > 255) {
+        throw runtime_error("Ring size must be in range [2, 255]");
+    }
     string zero_str = variant_node["zero_element"].as<string>();
     string one_str = variant_node["one_element"].as<string>();
     
@@ -111,14 +117,14 @@ void FiniteRingRules::init(const YAML::Node& variant_node) {
     
     // итоговоые контейнеры класса 
     values_.clear();        // контейнер значений
-    char_to_val_.clear();   // мапа char -> int
+    char_to_val_.fill(INVALID_INDEX);   // таблица char -> int на 256 ячеек
     
     // * устанавливаем 0 и 1
     values_.push_back(zero_);
-    char_to_val_[zero_] = 0;
+    char_to_val_[static_cast<unsigned char>(zero_)] = 0;
 
     values_.push_back(one_);
-    char_to_val_[one_] = 1;
+    char_to_val_[static_cast<unsigned char>(one_)] = 1;
 
     // * заполняем остальные элементы
     int current_index = 2; // начинаем с индекса 2
@@ -126,10 +132,80 @@ void FiniteRingRules::init(const YAML::Node& variant_node) {
         // * берем элементы из исходной послед.
         if (c != zero_ && c != one_) {
             values_.push_back(c);
-            char_to_val_[c] = current_index;
+            char_to_val_[static_cast<unsigned char>(c)] = current_index;
             current_index++;
         }
     }
+
+    buildTables();
+}
+
+// * --- ТАБЛИЦЫ КЭЛИ ---
+// индекс символа = число шагов "+1" от нуля, поэтому обход цикла
+// сворачивается в арифметику по модулю size_ над индексами
+void FiniteRingRules::buildTables() {
+    const int n = size_;
+    const size_t cells = static_cast<size_t>(n) * n;
+
+    add_table_.assign(cells, 0);
+    sub_table_.assign(cells, 0);
+    mul_table_.assign(cells, 0);
+    neg_table_.assign(n, 0);
+    inv_table_.assign(n, NO_INVERSE);
+
+    for (int a = 0; a < n; ++a) {
+        neg_table_[a] = static_cast<uint8_t>((n - a) % n);
+        for (int b = 0; b < n; ++b) {
+            add_table_[a * n + b] = static_cast<uint8_t>((a + b) % n);
+            mul_table_[a * n + b] = static_cast<uint8_t>((a * b) % n);
+        }
+    }
+
+    // вычитание как сложение с противоположным (a - b = a + (-b))
+    for (int a = 0; a < n; ++a) {
+        for (int b = 0; b < n; ++b) {
+            sub_table_[a * n + b] = add_table_[a * n + neg_table_[b]];
+        }
+    }
+
+    // * переносы и заёмы по порядку кольца: сумма выходит за N-1
+    // * (или разность уходит ниже нуля) ровно тогда, когда цифра обернулась
+    carry_table_.assign(2 * cells, 0);
+    borrow_table_.assign(2 * cells, 0);
+    for (int c = 0; c <= 1; ++c) {
+        for (int a = 0; a < n; ++a) {
+            for (int b = 0; b < n; ++b) {
+                size_t cell = (static_cast<size_t>(c) * n + a) * n + b;
+
+                int sum = a + b + c;
+                int carry = sum >= n ? 1 : 0;
+                carry_table_[cell] = static_cast<uint16_t>((sum - carry * n) | (carry << 8));
+
+                int diff = a - b - c;
+                int borrow = diff < 0 ? 1 : 0;
+                borrow_table_[cell] = static_cast<uint16_t>((diff + borrow * n) | (borrow << 8));
+            }
+        }
+    }
+
+    // * раскладка limb'а: наибольшее k, при котором N^k <= 2^63
+    const uint64_t limit = uint64_t(1) << 63;
+    digits_per_limb_ = 0;
+    limb_base_ = 1;
+    while (limb_base_ <= limit / static_cast<uint64_t>(n)) {
+        limb_base_ *= static_cast<uint64_t>(n);
+        digits_per_limb_++;
+    }
+
+    // * обратный по умножению: первый кандидат по циклу начиная с единицы
+    for (int a = 1; a < n; ++a) {
+        for (int c = 1; c < n; ++c) {
+            if (mul_table_[a * n + c] == 1) {
+                inv_table_[a] = static_cast<uint8_t>(c);
+                break;
+            }
+        }
+    }
 }
 
 #ifdef DEBUG
@@ -150,19 +226,9 @@ const std::vector<char>& FiniteRingRules::getOrderedValues() const {
     return values_; 
 }
 
-int FiniteRingRules::getCharValue(char c) const {
-    auto it = char_to_val_.find(c);
-    
-    if (it == char_to_val_.end()) {
-        throw runtime_error("Invalid character: '" + string(1, c) + 
-                          "' (not in ring)");
-    }
-    
-    return it->second;
-}
-
-bool FiniteRingRules::isValidChar(char c) const {
-    return char_to_val_.find(c) != char_to_val_.end();
+void FiniteRingRules::throwInvalidChar(char c) {
+    throw runtime_error("Invalid character: '" + string(1, c) + 
+                      "' (not in ring)");
 }
 
 void FiniteRingRules::printRules() const {
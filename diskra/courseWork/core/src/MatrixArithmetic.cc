@@ -0,0 +1,299 @@
+// core/src/MatrixArithmetic.cc
+#include "MatrixArithmetic.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using std::runtime_error;
+
+namespace {
+
+// * блоки умножения: 16 строк A, 128 × 512 из B (64 КБ), сумма 16 × 512 uint32
+const size_t kRowBlock = 16;
+const size_t kDepthBlock = 128;
+const size_t kColBlock = 512;
+// * блок транспонирования
+const size_t kTransposeBlock = 32;
+// * меньше ячеек на шаг исключения - пул не будится
+const size_t kParallelCells = 1 << 15;
+// * приведение без таблиц: x <= (N-1) + (N-1)^2 <= 240, ошибка сдвига < 1/N
+const int kArithmeticMaxSize = 16;
+
+}  // namespace
+
+MatrixArithmetic::MatrixArithmetic(const SmallRingArithmetic& small, unsigned threads)
+    : rules_(small.getRules()), small_(small),
+      pool_(std::make_unique<WorkStealingPool>(threads)),
+      reciprocal_(static_cast<uint32_t>((4096 + rules_.getSize() - 1) / rules_.getSize())) {}
+
+MatrixArithmetic::~MatrixArithmetic() = default;
+
+// * --- ПОЭЛЕМЕНТНЫЕ ОПЕРАЦИИ ---
+RingMatrix MatrixArithmetic::add(const RingMatrix& a, const RingMatrix& b) const {
+    checkRules(a);
+    checkRules(b);
+    if (a.rows() != b.rows() || a.cols() != b.cols()) {
+        throw runtime_error("Matrix dimensions mismatch for add");
+    }
+    vector<uint8_t> out(a.getValues().size());
+    small_.addMany(a.getValues().data(), b.getValues().data(), out.data(), out.size());
+    return RingMatrix(rules_, a.rows(), a.cols(), std::move(out));
+}
+
+RingMatrix MatrixArithmetic::subtract(const RingMatrix& a, const RingMatrix& b) const {
+    checkRules(a);
+    checkRules(b);
+    if (a.rows() != b.rows() || a.cols() != b.cols()) {
+        throw runtime_error("Matrix dimensions mismatch for subtract");
+    }
+    vector<uint8_t> out(a.getValues().size());
+    small_.subMany(a.getValues().data(), b.getValues().data(), out.data(), out.size());
+    return RingMatrix(rules_, a.rows(), a.cols(), std::move(out));
+}
+
+RingMatrix MatrixArithmetic::transpose(const RingMatrix& a) const {
+    checkRules(a);
+    RingMatrix result(rules_, a.cols(), a.rows());
+    for (size_t r0 = 0; r0 < a.rows(); r0 += kTransposeBlock) {
+        const size_t r1 = std::min(a.rows(), r0 + kTransposeBlock);
+        for (size_t c0 = 0; c0 < a.cols(); c0 += kTransposeBlock) {
+            const size_t c1 = std::min(a.cols(), c0 + kTransposeBlock);
+            for (size_t r = r0; r < r1; ++r) {
+                for (size_t c = c0; c < c1; ++c) {
+                    result.set(c, r, a.at(r, c));
+                }
+            }
+        }
+    }
+    return result;
+}
+
+// * --- УМНОЖЕНИЕ (блоками, строки результата - пулу) ---
+RingMatrix MatrixArithmetic::multiply(const RingMatrix& a, const RingMatrix& b) const {
+    checkRules(a);
+    checkRules(b);
+    if (a.cols() != b.rows()) {
+        throw runtime_error("Matrix dimensions mismatch for multiply: " + std::to_string(a.cols()) +
+                            " columns vs " + std::to_string(b.rows()) + " rows");
+    }
+
+    const size_t m = a.rows();
+    const size_t depth = a.cols();
+    const size_t p = b.cols();
+    const uint32_t n = static_cast<uint32_t>(rules_.getSize());
+    // сумма по всей глубине помещается в uint32 - приводим один раз
+    const uint64_t bound = static_cast<uint64_t>(n - 1) * (n - 1) * depth;
+    const bool reduce_each_block = bound > UINT32_MAX;
+
+    RingMatrix result(rules_, m, p);
+    const uint64_t blocks = (m + kRowBlock - 1) / kRowBlock;
+    pool_->parallelFor(blocks, 1, [&](uint64_t begin, uint64_t end) {
+        vector<uint32_t> acc(kRowBlock * kColBlock);
+        for (uint64_t block = begin; block < end; ++block) {
+            const size_t i0 = block * kRowBlock;
+            const size_t i1 = std::min(m, i0 + kRowBlock);
+            for (size_t j0 = 0; j0 < p; j0 += kColBlock) {
+                const size_t width = std::min(p, j0 + kColBlock) - j0;
+                std::fill(acc.begin(), acc.end(), 0);
+
+                for (size_t k0 = 0; k0 < depth; k0 += kDepthBlock) {
+                    const size_t k1 = std::min(depth, k0 + kDepthBlock);
+                    for (size_t i = i0; i < i1; ++i) {
+                        const uint8_t* a_row = a.row(i);
+                        uint32_t* c_row = acc.data() + (i - i0) * width;
+                        for (size_t k = k0; k < k1; ++k) {
+                            const uint32_t f = a_row[k];
+                            if (f == 0) {
+                                continue;
+                            }
+                            const uint8_t* b_row = b.row(k) + j0;
+                            for (size_t j = 0; j < width; ++j) {
+                                c_row[j] += f * b_row[j];
+                            }
+                        }
+                        if (reduce_each_block) {
+                            for (size_t j = 0; j < width; ++j) {
+                                c_row[j] %= n;
+                            }
+                        }
+                    }
+                }
+
+                for (size_t i = i0; i < i1; ++i) {
+                    const uint32_t* c_row = acc.data() + (i - i0) * width;
+                    uint8_t* out = result.row(i) + j0;
+                    for (size_t j = 0; j < width; ++j) {
+                        out[j] = static_cast<uint8_t>(c_row[j] % n);
+                    }
+                }
+            }
+        }
+        return true;
+    });
+    return result;
+}
+
+// * --- ИСКЛЮЧЕНИЕ ГАУССА ---
+RingMatrix MatrixArithmetic::rowEchelon(const RingMatrix& a) const {
+    checkRules(a);
+    RingMatrix result = a;
+    eliminate(result, result.cols(), true);
+    return result;
+}
+
+size_t MatrixArithmetic::rank(const RingMatrix& a) const {
+    checkRules(a);
+    RingMatrix work = a;
+    return eliminate(work, work.cols(), false).rank;
+}
+
+uint8_t MatrixArithmetic::determinant(const RingMatrix& a) const {
+    checkRules(a);
+    if (!a.isSquare()) {
+        throw runtime_error("Determinant requires a square matrix");
+    }
+    RingMatrix work = a;
+    return eliminate(work, work.cols(), false).determinant;
+}
+
+RingMatrix MatrixArithmetic::inverse(const RingMatrix& a) const {
+    checkRules(a);
+    if (!a.isSquare()) {
+        throw runtime_error("Inverse requires a square matrix");
+    }
+    RingMatrix work = augment(a, RingMatrix::identity(rules_, a.rows()));
+    if (eliminate(work, a.cols(), true).rank < a.rows()) {
+        throw runtime_error("Matrix is singular");
+    }
+    return work.columns(a.cols(), a.cols());
+}
+
+RingMatrix MatrixArithmetic::solve(const RingMatrix& a, const RingMatrix& b) const {
+    checkRules(a);
+    checkRules(b);
+    if (!a.isSquare()) {
+        throw runtime_error("Solve requires a square matrix");
+    }
+    RingMatrix work = augment(a, b);
+    if (eliminate(work, a.cols(), true).rank < a.rows()) {
+        throw runtime_error("Matrix is singular");
+    }
+    return work.columns(a.cols(), b.cols());
+}
+
+// строки левее столбца c у ведущей строки уже нулевые, поэтому
+// обновление идёт только по столбцам [c, cols)
+EchelonResult MatrixArithmetic::eliminate(RingMatrix& m, size_t pivot_cols, bool reduced) const {
+    requireField();
+    const size_t rows = m.rows();
+    const size_t cols = m.cols();
+    const vector<uint8_t>& inv = rules_.getInvTable();
+    const vector<uint8_t>& neg = rules_.getNegTable();
+
+    uint8_t det = 1;
+    size_t rank = 0;
+    for (size_t c = 0; c < pivot_cols && rank < rows; ++c) {
+        size_t pivot_row = rank;
+        while (pivot_row < rows && m.at(pivot_row, c) == 0) {
+            ++pivot_row;
+        }
+        if (pivot_row == rows) {
+            continue;
+        }
+        if (pivot_row != rank) {
+            std::swap_ranges(m.row(pivot_row) + c, m.row(pivot_row) + cols, m.row(rank) + c);
+            det = neg[det];
+        }
+
+        const uint8_t value = m.at(rank, c);
+        det = small_.multiplyIndex(det, value);
+        const size_t width = cols - c;
+        uint8_t* pivot = m.row(rank) + c;
+        scaleRow(pivot, inv[value], width);
+
+        const size_t first = reduced ? 0 : rank + 1;
+        const size_t skip = rank;
+        auto update = [&](uint64_t begin, uint64_t end) {
+            for (uint64_t r = begin; r < end; ++r) {
+                uint8_t* target = m.row(r) + c;
+                if (r != skip && target[0] != 0) {
+                    subtractRow(target, pivot, target[0], width);
+                }
+            }
+            return true;
+        };
+        if ((rows - first) * width < kParallelCells || pool_->size() < 2) {
+            update(first, rows);
+        } else {
+            const uint64_t grain = std::max<uint64_t>(1, kParallelCells / width);
+            pool_->parallelFor(rows - first, grain, [&](uint64_t begin, uint64_t end) {
+                return update(first + begin, first + end);
+            });
+        }
+        ++rank;
+    }
+    return EchelonResult{rank, rank == rows ? det : uint8_t(0)};
+}
+
+void MatrixArithmetic::subtractRow(uint8_t* row, const uint8_t* pivot, uint8_t factor, size_t count) const {
+    const uint32_t n = static_cast<uint32_t>(rules_.getSize());
+    if (rules_.getSize() <= kArithmeticMaxSize) {
+        // row - f * pivot = row + (N - f) * pivot (mod N)
+        const uint32_t minus = n - factor;
+        const uint32_t reciprocal = reciprocal_;
+        for (size_t k = 0; k < count; ++k) {
+            const uint32_t x = row[k] + minus * pivot[k];
+            row[k] = static_cast<uint8_t>(x - ((x * reciprocal) >> 12) * n);
+        }
+        return;
+    }
+    const uint8_t* sub = rules_.getSubTable().data();
+    const uint8_t* mul = rules_.getMulTable().data() + static_cast<size_t>(factor) * n;
+    for (size_t k = 0; k < count; ++k) {
+        row[k] = sub[row[k] * n + mul[pivot[k]]];
+    }
+}
+
+void MatrixArithmetic::scaleRow(uint8_t* row, uint8_t factor, size_t count) const {
+    const size_t n = static_cast<size_t>(rules_.getSize());
+    const uint8_t* mul = rules_.getMulTable().data() + factor * n;
+    for (size_t k = 0; k < count; ++k) {
+        row[k] = mul[row[k]];
+    }
+}
+
+// * --- ВСПОМОГАТЕЛЬНЫЕ ---
+RingMatrix MatrixArithmetic::augment(const RingMatrix& a, const RingMatrix& b) const {
+    if (a.rows() != b.rows()) {
+        throw runtime_error("Matrix dimensions mismatch: " + std::to_string(a.rows()) + " vs " +
+                            std::to_string(b.rows()) + " rows");
+    }
+    RingMatrix result(rules_, a.rows(), a.cols() + b.cols());
+    for (size_t r = 0; r < a.rows(); ++r) {
+        std::copy(a.row(r), a.row(r) + a.cols(), result.row(r));
+        std::copy(b.row(r), b.row(r) + b.cols(), result.row(r) + a.cols());
+    }
+    return result;
+}
+
+bool MatrixArithmetic::isField() const {
+    const vector<uint8_t>& inv = rules_.getInvTable();
+    return std::none_of(inv.begin() + 1, inv.end(),
+                        [](uint8_t v) { return v == FiniteRingRules::NO_INVERSE; });
+}
+
+void MatrixArithmetic::requireField() const {
+    if (!isField()) {
+        throw runtime_error("Gaussian elimination requires a field: Z" + std::to_string(rules_.getSize()) +
+                            " has zero divisors");
+    }
+}
+
+// индексы одинаково значат для всех вариантов одного размера
+void MatrixArithmetic::checkRules(const RingMatrix& a) const {
+    if (a.getRules().getSize() != rules_.getSize()) {
+        throw runtime_error("Ring size mismatch: expected " + std::to_string(rules_.getSize()) +
+                            ", got " + std::to_string(a.getRules().getSize()));
+    }
+}
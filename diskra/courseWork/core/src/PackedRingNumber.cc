@@ -0,0 +1,78 @@
+// core/src/PackedRingNumber.cc
+#include "PackedRingNumber.h"
+#include <stdexcept>
+#include <algorithm>
+
+using std::vector;
+using std::runtime_error;
+
+PackedRingNumber::PackedRingNumber(const FiniteRingRules& rules)
+    : rules_(&rules), limbs_(1, 0), is_negative_(false) {}
+
+// упаковка: каждые k цифр сворачиваем схемой Горнера в один limb
+PackedRingNumber::PackedRingNumber(const RingNumber& num)
+    : rules_(&num.getRules()), is_negative_(num.isNegative()) {
+    const DigitBuffer& digits = num.getValues();
+    const size_t k = static_cast<size_t>(rules_->getDigitsPerLimb());
+    const uint64_t base = static_cast<uint64_t>(rules_->getSize());
+
+    limbs_.reserve((digits.size() + k - 1) / k);
+    for (size_t start = 0; start < digits.size(); start += k) {
+        size_t end = std::min(start + k, digits.size());
+        uint64_t limb = 0;
+        for (size_t i = end; i > start; --i) {
+            limb = limb * base + digits[i - 1];
+        }
+        limbs_.push_back(limb);
+    }
+    normalize();
+}
+
+PackedRingNumber::PackedRingNumber(const FiniteRingRules& rules, vector<uint64_t> limbs, bool is_negative)
+    : rules_(&rules), limbs_(std::move(limbs)), is_negative_(is_negative) {
+    const uint64_t limb_base = rules_->getLimbBase();
+    for (uint64_t limb : limbs_) {
+        if (limb >= limb_base) {
+            throw runtime_error("PackedRingNumber limb out of range");
+        }
+    }
+    normalize();
+}
+
+// распаковка: k раз делим limb на N, последний limb - до нуля
+RingNumber PackedRingNumber::toRingNumber() const {
+    const size_t k = static_cast<size_t>(rules_->getDigitsPerLimb());
+    const uint64_t base = static_cast<uint64_t>(rules_->getSize());
+
+    DigitBuffer digits;
+    digits.reserve(limbs_.size() * k);
+    for (size_t j = 0; j < limbs_.size(); ++j) {
+        uint64_t limb = limbs_[j];
+        bool top = (j + 1 == limbs_.size());
+        for (size_t i = 0; i < k && (!top || limb != 0); ++i) {
+            digits.push_back(static_cast<uint8_t>(limb % base));
+            limb /= base;
+        }
+    }
+    if (digits.empty()) {
+        digits.push_back(0);
+    }
+    return RingNumber(*rules_, std::move(digits), is_negative_);
+}
+
+bool PackedRingNumber::operator==(const PackedRingNumber& other) const {
+    return rules_ == other.rules_ && is_negative_ == other.is_negative_ &&
+           limbs_ == other.limbs_;
+}
+
+void PackedRingNumber::normalize() {
+    while (limbs_.size() > 1 && limbs_.back() == 0) {
+        limbs_.pop_back();
+    }
+    if (limbs_.empty()) {
+        limbs_.push_back(0);
+    }
+    if (isZero()) {
+        is_negative_ = false;
+    }
+}
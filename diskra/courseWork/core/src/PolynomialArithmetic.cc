@@ -0,0 +1,217 @@
+// core/src/PolynomialArithmetic.cc
+#include "PolynomialArithmetic.h"
+#include <algorithm>
+#include <stdexcept>
+#include "Convolution.h"
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+
+namespace {
+
+// коэффициенты, дополненные нулями до length
+vector<uint8_t> padded(const RingPolynomial& p, size_t length) {
+    vector<uint8_t> result(p.getCoefficients());
+    result.resize(length, 0);
+    return result;
+}
+
+}  // namespace
+
+// * --- СЛОЖЕНИЕ И ВЫЧИТАНИЕ (пакетные ядра) ---
+RingPolynomial PolynomialArithmetic::add(const RingPolynomial& a, const RingPolynomial& b) const {
+    checkRules(a);
+    checkRules(b);
+    const size_t length = std::max(a.getCoefficients().size(), b.getCoefficients().size());
+    const vector<uint8_t> pa = padded(a, length);
+    const vector<uint8_t> pb = padded(b, length);
+    vector<uint8_t> out(length);
+    small_.addMany(pa.data(), pb.data(), out.data(), length);
+    return RingPolynomial(rules_, std::move(out));
+}
+
+RingPolynomial PolynomialArithmetic::subtract(const RingPolynomial& a, const RingPolynomial& b) const {
+    checkRules(a);
+    checkRules(b);
+    const size_t length = std::max(a.getCoefficients().size(), b.getCoefficients().size());
+    const vector<uint8_t> pa = padded(a, length);
+    const vector<uint8_t> pb = padded(b, length);
+    vector<uint8_t> out(length);
+    small_.subMany(pa.data(), pb.data(), out.data(), length);
+    return RingPolynomial(rules_, std::move(out));
+}
+
+RingPolynomial PolynomialArithmetic::negate(const RingPolynomial& a) const {
+    checkRules(a);
+    const vector<uint8_t>& neg = rules_.getNegTable();
+    vector<uint8_t> out(a.getCoefficients());
+    for (uint8_t& c : out) {
+        c = neg[c];
+    }
+    return RingPolynomial(rules_, std::move(out));
+}
+
+RingPolynomial PolynomialArithmetic::scale(const RingPolynomial& a, uint8_t factor) const {
+    checkRules(a);
+    if (factor >= rules_.getSize()) {
+        throw runtime_error("Coefficient index out of range: " + std::to_string(factor));
+    }
+    const uint8_t* row = rules_.getMulTable().data() + static_cast<size_t>(factor) * rules_.getSize();
+    vector<uint8_t> out(a.getCoefficients());
+    for (uint8_t& c : out) {
+        c = row[c];
+    }
+    return RingPolynomial(rules_, std::move(out));
+}
+
+// * --- УМНОЖЕНИЕ ---
+// короткие - по таблицам, длинные - Карацуба в int64 и одно приведение по N
+RingPolynomial PolynomialArithmetic::multiply(const RingPolynomial& a, const RingPolynomial& b) const {
+    checkRules(a);
+    checkRules(b);
+    if (a.isZero() || b.isZero()) {
+        return RingPolynomial(rules_);
+    }
+
+    const vector<uint8_t>& ca = a.getCoefficients();
+    const vector<uint8_t>& cb = b.getCoefficients();
+    const size_t la = ca.size();
+    const size_t lb = cb.size();
+    const size_t n = static_cast<size_t>(rules_.getSize());
+    vector<uint8_t> out(la + lb - 1, 0);
+
+    if (std::min(la, lb) < KARATSUBA_THRESHOLD) {
+        const uint8_t* add = rules_.getAddTable().data();
+        const uint8_t* mul = rules_.getMulTable().data();
+        for (size_t i = 0; i < la; ++i) {
+            if (ca[i] == 0) {
+                continue;
+            }
+            const uint8_t* row = mul + ca[i] * n;
+            uint8_t* target = out.data() + i;
+            for (size_t j = 0; j < lb; ++j) {
+                target[j] = add[target[j] * n + row[cb[j]]];
+            }
+        }
+        return RingPolynomial(rules_, std::move(out));
+    }
+
+    vector<int64_t> wide(la + lb + out.size());
+    int64_t* wide_a = wide.data();
+    int64_t* wide_b = wide_a + la;
+    int64_t* coefficients = wide_b + lb;
+    std::copy(ca.begin(), ca.end(), wide_a);
+    std::copy(cb.begin(), cb.end(), wide_b);
+    convolve(wide_a, la, wide_b, lb, coefficients);
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<uint8_t>(coefficients[i] % static_cast<int64_t>(n));
+    }
+    return RingPolynomial(rules_, std::move(out));
+}
+
+// * --- ДЕЛЕНИЕ С ОСТАТКОМ ---
+PolynomialDivisionResult PolynomialArithmetic::divide(const RingPolynomial& a, const RingPolynomial& b) const {
+    checkRules(a);
+    checkRules(b);
+    if (b.isZero()) {
+        throw runtime_error("Division by zero");
+    }
+    const uint8_t lead_inverse = inverse(b.leadingCoefficient());
+
+    const vector<uint8_t>& cb = b.getCoefficients();
+    const size_t la = a.getCoefficients().size();
+    const size_t lb = cb.size();
+    if (la < lb) {
+        return PolynomialDivisionResult(RingPolynomial(rules_), a);
+    }
+
+    // старший член остатка гасится вычитанием q_i * x^i * b
+    vector<uint8_t> remainder(a.getCoefficients());
+    vector<uint8_t> quotient(la - lb + 1, 0);
+    const uint8_t* mul = rules_.getMulTable().data();
+    const size_t n = static_cast<size_t>(rules_.getSize());
+    for (size_t i = la - lb + 1; i > 0; --i) {
+        const uint8_t top = remainder[i - 1 + lb - 1];
+        if (top == 0) {
+            continue;
+        }
+        const uint8_t q = mul[top * n + lead_inverse];
+        quotient[i - 1] = q;
+        subtractScaled(remainder.data() + i - 1, cb, q);
+    }
+    remainder.resize(lb - 1);
+    return PolynomialDivisionResult(RingPolynomial(rules_, std::move(quotient)),
+                                    RingPolynomial(rules_, std::move(remainder)));
+}
+
+// * --- НОД (алгоритм Евклида над полем) ---
+RingPolynomial PolynomialArithmetic::gcd(const RingPolynomial& a, const RingPolynomial& b) const {
+    checkRules(a);
+    checkRules(b);
+    if (!isField()) {
+        throw runtime_error("Polynomial gcd requires a field: Z" + std::to_string(rules_.getSize()) +
+                            " has zero divisors");
+    }
+    RingPolynomial x = a;
+    RingPolynomial y = b;
+    while (!y.isZero()) {
+        RingPolynomial r = divide(x, y).remainder;
+        x = std::move(y);
+        y = std::move(r);
+    }
+    return monic(x);
+}
+
+RingPolynomial PolynomialArithmetic::monic(const RingPolynomial& a) const {
+    if (a.isZero()) {
+        return a;
+    }
+    return scale(a, inverse(a.leadingCoefficient()));
+}
+
+uint8_t PolynomialArithmetic::evaluate(const RingPolynomial& a, uint8_t x) const {
+    checkRules(a);
+    if (x >= rules_.getSize()) {
+        throw runtime_error("Coefficient index out of range: " + std::to_string(x));
+    }
+    const vector<uint8_t>& c = a.getCoefficients();
+    uint8_t value = 0;
+    for (size_t i = c.size(); i > 0; --i) {
+        value = small_.addIndex(small_.multiplyIndex(value, x), c[i - 1]);
+    }
+    return value;
+}
+
+bool PolynomialArithmetic::isField() const {
+    const vector<uint8_t>& inv = rules_.getInvTable();
+    return std::none_of(inv.begin() + 1, inv.end(),
+                        [](uint8_t v) { return v == FiniteRingRules::NO_INVERSE; });
+}
+
+// * --- ВСПОМОГАТЕЛЬНЫЕ ---
+void PolynomialArithmetic::subtractScaled(uint8_t* out, const vector<uint8_t>& b, uint8_t factor) const {
+    const size_t n = static_cast<size_t>(rules_.getSize());
+    const uint8_t* sub = rules_.getSubTable().data();
+    const uint8_t* row = rules_.getMulTable().data() + factor * n;
+    for (size_t j = 0; j < b.size(); ++j) {
+        out[j] = sub[out[j] * n + row[b[j]]];
+    }
+}
+
+uint8_t PolynomialArithmetic::inverse(uint8_t value) const {
+    const uint8_t inv = rules_.getInvTable()[value];
+    if (inv == FiniteRingRules::NO_INVERSE) {
+        throw runtime_error("Leading coefficient is not invertible: " +
+                            string(1, rules_.getValueChar(value)));
+    }
+    return inv;
+}
+
+// индексы одинаково значат для всех вариантов одного размера
+void PolynomialArithmetic::checkRules(const RingPolynomial& a) const {
+    if (a.getRules().getSize() != rules_.getSize()) {
+        throw runtime_error("Ring size mismatch: expected " + std::to_string(rules_.getSize()) +
+                            ", got " + std::to_string(a.getRules().getSize()));
+    }
+}
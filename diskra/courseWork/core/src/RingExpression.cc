@@ -0,0 +1,256 @@
+// core/src/RingExpression.cc
+#include "RingExpression.h"
+#include <stdexcept>
+#include <cctype>
+#include <sstream>
+#include <algorithm>
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+
+RingExpression::RingExpression(const FiniteRingRules& rules, const BigRingArithmetic& big,
+                               const string& source, vector<string> variables)
+    : rules_(rules), big_(big), source_(source), variables_(std::move(variables)) {
+    for (size_t i = 0; i < variables_.size(); ++i) {
+        if (std::find(variables_.begin(), variables_.begin() + i, variables_[i]) != variables_.begin() + i) {
+            throw runtime_error("Duplicate variable name: '" + variables_[i] + "'");
+        }
+    }
+    compile();
+}
+
+// * --- КОМПИЛЯЦИЯ ---
+void RingExpression::compile() {
+    pos_ = 0;
+    parseExpr();
+    skipSpaces();
+    if (pos_ != source_.size()) {
+        fail("unexpected '" + string(1, source_[pos_]) + "'");
+    }
+
+    // глубина стека по байткоду: под неё резервируем стек один раз
+    size_t depth = 0;
+    for (const Instruction& ins : code_) {
+        if (ins.op == OpCode::PushConst || ins.op == OpCode::PushVar) {
+            max_stack_ = std::max(max_stack_, ++depth);
+        } else if (ins.op != OpCode::Neg) {
+            --depth;
+        }
+    }
+}
+
+void RingExpression::parseExpr() {
+    parseTerm();
+    for (;;) {
+        skipSpaces();
+        if (pos_ >= source_.size() || (source_[pos_] != '+' && source_[pos_] != '-')) {
+            return;
+        }
+        OpCode op = source_[pos_++] == '+' ? OpCode::Add : OpCode::Sub;
+        parseTerm();
+        emit(op);
+    }
+}
+
+void RingExpression::parseTerm() {
+    parseUnary();
+    for (;;) {
+        skipSpaces();
+        if (pos_ >= source_.size()) {
+            return;
+        }
+        OpCode op;
+        switch (source_[pos_]) {
+            case '*': op = OpCode::Mul; break;
+            case '/': op = OpCode::Div; break;
+            case '%': op = OpCode::Mod; break;
+            default: return;
+        }
+        ++pos_;
+        parseUnary();
+        emit(op);
+    }
+}
+
+void RingExpression::parseUnary() {
+    skipSpaces();
+    if (pos_ < source_.size() && source_[pos_] == '-') {
+        ++pos_;
+        parseUnary();
+        emit(OpCode::Neg);
+        return;
+    }
+    parsePrimary();
+}
+
+void RingExpression::parsePrimary() {
+    skipSpaces();
+    if (pos_ >= source_.size()) {
+        fail("unexpected end of expression");
+    }
+
+    if (source_[pos_] == '(') {
+        ++pos_;
+        parseExpr();
+        skipSpaces();
+        if (pos_ >= source_.size() || source_[pos_] != ')') {
+            fail("expected ')'");
+        }
+        ++pos_;
+        return;
+    }
+
+    // слово: буквы, цифры, '_' и любые символы кольца
+    const size_t start = pos_;
+    while (pos_ < source_.size()) {
+        char c = source_[pos_];
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && !rules_.isValidChar(c)) {
+            break;
+        }
+        ++pos_;
+    }
+    if (pos_ == start) {
+        fail("unexpected '" + string(1, source_[pos_]) + "'");
+    }
+
+    const string word = source_.substr(start, pos_ - start);
+    auto var = std::find(variables_.begin(), variables_.end(), word);
+    if (var != variables_.end()) {
+        emit(OpCode::PushVar, static_cast<uint32_t>(var - variables_.begin()));
+        return;
+    }
+
+    try {
+        constants_.emplace_back(rules_, word);
+    } catch (const runtime_error&) {
+        pos_ = start;
+        fail("unknown variable or invalid literal '" + word + "'");
+    }
+    emit(OpCode::PushConst, static_cast<uint32_t>(constants_.size() - 1));
+}
+
+void RingExpression::skipSpaces() {
+    while (pos_ < source_.size() && std::isspace(static_cast<unsigned char>(source_[pos_]))) {
+        ++pos_;
+    }
+}
+
+// ! константные операнды сворачиваются сразу; если операция бросает
+// ! (деление на ноль), она остаётся в коде и бросит при вычислении
+void RingExpression::emit(OpCode op, uint32_t operand) {
+    const size_t n = code_.size();
+
+    if (op == OpCode::Neg && n >= 1 && code_[n - 1].op == OpCode::PushConst) {
+        RingNumber& value = constants_[code_[n - 1].operand];
+        value = big_.negate(value);
+        return;
+    }
+
+    const bool binary = op != OpCode::PushConst && op != OpCode::PushVar && op != OpCode::Neg;
+    if (binary && n >= 2 && code_[n - 2].op == OpCode::PushConst && code_[n - 1].op == OpCode::PushConst) {
+        const uint32_t left = code_[n - 2].operand;
+        const uint32_t right = code_[n - 1].operand;
+        try {
+            constants_[left] = apply(op, constants_[left], constants_[right]);
+            code_.pop_back();
+            return;
+        } catch (const runtime_error&) {
+            // не сворачиваем
+        }
+    }
+
+    code_.push_back(Instruction{op, operand});
+}
+
+void RingExpression::fail(const string& message) const {
+    throw runtime_error("Expression error at position " + std::to_string(pos_) + ": " + message);
+}
+
+// * --- ВЫЧИСЛЕНИЕ ---
+RingNumber RingExpression::apply(OpCode op, const RingNumber& a, const RingNumber& b) const {
+    switch (op) {
+        case OpCode::Add: return big_.add(a, b);
+        case OpCode::Sub: return big_.subtract(a, b);
+        case OpCode::Mul: return big_.multiply(a, b);
+        case OpCode::Div: return big_.divide(a, b).quotient;
+        case OpCode::Mod: return big_.divide(a, b).remainder;
+        default: throw runtime_error("Invalid binary opcode");
+    }
+}
+
+template <typename Bindings>
+RingNumber RingExpression::run(vector<RingNumber>& stack, const Bindings& bindings) const {
+    stack.clear();
+    for (const Instruction& ins : code_) {
+        switch (ins.op) {
+            case OpCode::PushConst:
+                stack.push_back(constants_[ins.operand]);
+                break;
+            case OpCode::PushVar:
+                stack.push_back(bindings(ins.operand));
+                break;
+            case OpCode::Neg:
+                stack.back() = big_.negate(stack.back());
+                break;
+            default: {
+                RingNumber right = std::move(stack.back());
+                stack.pop_back();
+                stack.back() = apply(ins.op, stack.back(), right);
+                break;
+            }
+        }
+    }
+    return std::move(stack.back());
+}
+
+RingNumber RingExpression::evaluate(const vector<RingNumber>& bindings) const {
+    if (bindings.size() != variables_.size()) {
+        throw runtime_error("Expected " + std::to_string(variables_.size()) +
+                            " variable bindings, got " + std::to_string(bindings.size()));
+    }
+    vector<RingNumber> stack;
+    stack.reserve(max_stack_);
+    return run(stack, [&](uint32_t v) -> const RingNumber& { return bindings[v]; });
+}
+
+// без переменных пакет состоит из одного значения
+vector<RingNumber> RingExpression::evaluateBatch(const vector<vector<RingNumber>>& columns) const {
+    if (columns.size() != variables_.size()) {
+        throw runtime_error("Expected " + std::to_string(variables_.size()) +
+                            " variable columns, got " + std::to_string(columns.size()));
+    }
+    const size_t rows = columns.empty() ? 1 : columns[0].size();
+    for (const auto& column : columns) {
+        if (column.size() != rows) {
+            throw runtime_error("All variable columns must have the same length");
+        }
+    }
+
+    vector<RingNumber> results;
+    results.reserve(rows);
+    vector<RingNumber> stack;
+    stack.reserve(max_stack_);
+    for (size_t i = 0; i < rows; ++i) {
+        results.push_back(run(stack, [&](uint32_t v) -> const RingNumber& { return columns[v][i]; }));
+    }
+    return results;
+}
+
+string RingExpression::disassemble() const {
+    std::ostringstream out;
+    for (const Instruction& ins : code_) {
+        switch (ins.op) {
+            case OpCode::PushConst: out << "PUSH " << constants_[ins.operand].toString(); break;
+            case OpCode::PushVar: out << "LOAD " << variables_[ins.operand]; break;
+            case OpCode::Add: out << "ADD"; break;
+            case OpCode::Sub: out << "SUB"; break;
+            case OpCode::Mul: out << "MUL"; break;
+            case OpCode::Div: out << "DIV"; break;
+            case OpCode::Mod: out << "MOD"; break;
+            case OpCode::Neg: out << "NEG"; break;
+        }
+        out << "\n";
+    }
+    return out.str();
+}
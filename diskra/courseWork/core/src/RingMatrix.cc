@@ -0,0 +1,78 @@
+// core/src/RingMatrix.cc
+#include "RingMatrix.h"
+#include <algorithm>
+#include <stdexcept>
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+
+RingMatrix::RingMatrix(const FiniteRingRules& rules, size_t rows, size_t cols)
+    : rules_(&rules), rows_(rows), cols_(cols), values_(rows * cols, 0) {}
+
+RingMatrix::RingMatrix(const FiniteRingRules& rules, size_t rows, size_t cols, vector<uint8_t> values)
+    : rules_(&rules), rows_(rows), cols_(cols), values_(std::move(values)) {
+    if (values_.size() != rows * cols) {
+        throw runtime_error("Matrix size mismatch: " + std::to_string(values_.size()) + " values for " +
+                            std::to_string(rows) + "x" + std::to_string(cols));
+    }
+    const int n = rules_->getSize();
+    for (uint8_t v : values_) {
+        if (v >= n) {
+            throw runtime_error("Matrix element index out of range: " + std::to_string(v));
+        }
+    }
+}
+
+RingMatrix RingMatrix::identity(const FiniteRingRules& rules, size_t n) {
+    RingMatrix result(rules, n, n);
+    for (size_t i = 0; i < n; ++i) {
+        result.set(i, i, 1);
+    }
+    return result;
+}
+
+RingMatrix RingMatrix::fromStrings(const FiniteRingRules& rules, const vector<string>& rows) {
+    const size_t cols = rows.empty() ? 0 : rows.front().size();
+    RingMatrix result(rules, rows.size(), cols);
+    for (size_t r = 0; r < rows.size(); ++r) {
+        if (rows[r].size() != cols) {
+            throw runtime_error("Matrix rows must have equal length: row " + std::to_string(r));
+        }
+        for (size_t c = 0; c < cols; ++c) {
+            result.set(r, c, static_cast<uint8_t>(rules.getCharValue(rows[r][c])));
+        }
+    }
+    return result;
+}
+
+RingMatrix RingMatrix::columns(size_t first, size_t count) const {
+    if (first + count > cols_) {
+        throw runtime_error("Column range out of bounds");
+    }
+    RingMatrix result(*rules_, rows_, count);
+    for (size_t r = 0; r < rows_; ++r) {
+        std::copy(row(r) + first, row(r) + first + count, result.row(r));
+    }
+    return result;
+}
+
+string RingMatrix::toString() const {
+    const vector<char>& alphabet = rules_->getOrderedValues();
+    string result;
+    result.reserve(rows_ * (cols_ + 1));
+    for (size_t r = 0; r < rows_; ++r) {
+        if (r != 0) {
+            result.push_back('\n');
+        }
+        for (size_t c = 0; c < cols_; ++c) {
+            result.push_back(alphabet[at(r, c)]);
+        }
+    }
+    return result;
+}
+
+bool RingMatrix::operator==(const RingMatrix& other) const {
+    return rules_ == other.rules_ && rows_ == other.rows_ && cols_ == other.cols_ &&
+           values_ == other.values_;
+}
@@ -11,13 +11,13 @@ using std::runtime_error;
 // создает ноль
 // конструктор ноль просто создает ноль без знака
 RingNumber::RingNumber(const FiniteRingRules& rules)
-    : rules_(rules), is_negative_(false) {
-        digits_.push_back(rules_.getZeroElement());
+    : rules_(&rules), is_negative_(false) {
+        digits_.push_back(0);
 }
 
 // из строки читаем число слева направо потом переворачиваем короче
 RingNumber::RingNumber(const FiniteRingRules& rules, const string& value)
-    : rules_(rules), is_negative_(false) {
+    : rules_(&rules), is_negative_(false) {
         
     if (value.empty()) {
         throw runtime_error("Cannot create RingNumber from empty string");
@@ -37,70 +37,68 @@ RingNumber::RingNumber(const FiniteRingRules& rules, const string& value)
     digits_.reserve(value.size());
     for (auto it = new_value.rbegin(); it != new_value.rend(); ++it) {
         char c = *it;
-        if (!rules_.isValidChar(c)) {
+        int v = rules_->lookupIndex(c);
+        if (v == FiniteRingRules::INVALID_INDEX) {
             throw runtime_error("Invalid symbol in RingNumber constructor: " + string(1, c));
         }
-        digits_.push_back(c);
+        digits_.push_back(static_cast<uint8_t>(v));
     }
     normalize();
 }   
 
 // этот конструктор принимает вектор уже в формате младшие сначала
 RingNumber::RingNumber(const FiniteRingRules& rules, const vector<char>& value, bool is_negative)
-    : rules_(rules), is_negative_(is_negative) {
+    : rules_(&rules), is_negative_(is_negative) {
     if (value.empty()) {
         throw runtime_error("Cannot create RingNumber from empty vector");
     }
-    digits_ = value;
-    // std::reverse(digits_.begin(), digits_.end());
+
+    // символы переводим в индексы сразу, чужой символ = невалидное состояние
+    digits_.reserve(value.size());
+    for (char c : value) {
+        int v = rules_->lookupIndex(c);
+        if (v == FiniteRingRules::INVALID_INDEX) {
+            throw runtime_error("RingNumber is in an invalid state: invalid character " + string(1, c));
+        }
+        digits_.push_back(static_cast<uint8_t>(v));
+    }
 
     normalize();
-    validate();
 }  
 
-// копирования
-RingNumber::RingNumber(const RingNumber& other)
-    :rules_(other.rules_), digits_(other.digits_), is_negative_(other.is_negative_) {}
+// индексы уже в формате младшие сначала, копируем из вектора
+RingNumber::RingNumber(const FiniteRingRules& rules, const vector<uint8_t>& values, bool is_negative)
+    : RingNumber(rules, DigitBuffer(values.data(), values.size()), is_negative) {}
 
-// оператор присваивания
-RingNumber& RingNumber::operator=(const RingNumber& other) {
-    if (this != &other) {
-        if (&rules_ != &other.rules_){
-            throw runtime_error("Cannot assign RingNumbers with different rules");
-        }
-        digits_ = other.digits_;
-        is_negative_ = other.is_negative_;
-    }
-    return *this;
-}
-
-// доступ по индексу
-char& RingNumber::operator[](size_t index) {
-    if (index >= digits_.size()) {
-        throw std::out_of_range("RingNumber index out of range");
+// а буфер просто забираем
+RingNumber::RingNumber(const FiniteRingRules& rules, DigitBuffer values, bool is_negative)
+    : rules_(&rules), digits_(std::move(values)), is_negative_(is_negative) {
+    if (digits_.empty()) {
+        throw runtime_error("Cannot create RingNumber from empty vector");
     }
-    return digits_[index];
+    validate();
+    normalize();
 }
 
-// доступ по индексу
+// доступ по индексу (символ цифры)
 char RingNumber::operator[](size_t index) const {
     if (index >= digits_.size()) {
         throw std::out_of_range("RingNumber index out of range");
     }
-    return digits_[index];
+    return rules_->getValueChar(digits_[index]);
 }
 
 char RingNumber::getDigit(size_t index) const {
     if (index >= digits_.size()) {
-        return rules_.getZeroElement();  // за пределами = ноль
+        return rules_->getZeroElement();  // за пределами = ноль
     }
-    return digits_[index];
+    return rules_->getValueChar(digits_[index]);
 }
 
 // преобразование в строку делаем простую печаль без доп символов
 string RingNumber::toString() const {
     if (digits_.empty()){
-        return string(1, rules_.getZeroElement());
+        return string(1, rules_->getZeroElement());
     }
 
     string result;
@@ -110,17 +108,27 @@ string RingNumber::toString() const {
         result.push_back('-');
     }
 
-    // записываем в обратном порядке
-    for (auto it = digits_.rbegin(); it != digits_.rend(); ++it){
-        result.push_back(*it);
+    // записываем в обратном порядке, индекс -> символ алфавита
+    const std::vector<char>& alphabet = rules_->getOrderedValues();
+    for (size_t i = digits_.size(); i > 0; --i){
+        result.push_back(alphabet[digits_[i - 1]]);
     }
 
     return result;
 }
 
+vector<char> RingNumber::toVector() const {
+    vector<char> symbols;
+    symbols.reserve(digits_.size());
+    for (uint8_t v : digits_) {
+        symbols.push_back(rules_->getValueChar(v));
+    }
+    return symbols;
+}
+
 // нормализация удаляем ведущие нули и обрубаем выше 8 разрядов
 void RingNumber::normalize() {
-    const char zero = rules_.getZeroElement();
+    const uint8_t zero = 0;
     
     // --- 1. Удаление ведущих нулей ---
     while (digits_.size() > 1 && digits_.back() == zero) {
@@ -155,13 +163,14 @@ void RingNumber::reverse() {
 
 // проверка на ноль
 bool RingNumber::isZero() const {
-    return digits_.size() == 1 && digits_[0] == rules_.getZeroElement();
+    return digits_.size() == 1 && digits_[0] == 0;
 }
 
-// проверка валидности символов типа все ок или нет
+// проверка валидности цифр типа все ок или нет
 bool RingNumber::isValid() const {
-    for (auto c : digits_) {
-        if (!rules_.isValidChar(c)) {
+    const int size = rules_->getSize();
+    for (auto v : digits_) {
+        if (v >= size) {
             return false;
         }
     }
@@ -179,25 +188,30 @@ size_t RingNumber::degree() const {
 // возвращает старший коэффициент
 char RingNumber::leadingCoefficient() const {
     if (isZero()) {
-        return rules_.getZeroElement();
+        return rules_->getZeroElement();
     }
-    return digits_.back();
+    return rules_->getValueChar(digits_.back());
 }
 
 bool RingNumber::operator==(const RingNumber& other) const {
-        if (&rules_ != &other.rules_) {
+        if (rules_ != other.rules_) {
         return false;
     }
     
-    // cравниваем нормализованные версии
-    RingNumber a(*this), b(other);
-    a.normalize();
-    b.normalize();
-    
-    if (a.is_negative_ != b.is_negative_) {
+    // cравниваем без ведущих нулей и без копий
+    size_t len_a = digits_.size();
+    size_t len_b = other.digits_.size();
+    while (len_a > 1 && digits_[len_a - 1] == 0) --len_a;
+    while (len_b > 1 && other.digits_[len_b - 1] == 0) --len_b;
+
+    if (len_a != len_b) {
+        return false;
+    }
+    bool zero = (len_a == 1 && digits_[0] == 0);
+    if (!zero && is_negative_ != other.is_negative_) {
         return false;
     }
-    return a.digits_ == b.digits_;
+    return std::equal(digits_.begin(), digits_.begin() + len_a, other.digits_.begin());
 }
 
 bool RingNumber::operator!=(const RingNumber& other) const {
@@ -205,9 +219,10 @@ bool RingNumber::operator!=(const RingNumber& other) const {
 }
 
 void RingNumber::validate() {
-    for (auto c : digits_) {
-        if (!rules_.isValidChar(c)) {
-            throw std::runtime_error("RingNumber is in an invalid state: invalid character " + std::string(1, c));
+    const int size = rules_->getSize();
+    for (auto v : digits_) {
+        if (v >= size) {
+            throw std::runtime_error("RingNumber is in an invalid state: invalid digit index " + std::to_string(v));
         }
     }
 }
@@ -0,0 +1,72 @@
+// core/src/RingPolynomial.cc
+#include "RingPolynomial.h"
+#include <stdexcept>
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+
+RingPolynomial::RingPolynomial(const FiniteRingRules& rules) : rules_(&rules) {}
+
+// символы читаем от старшей степени, храним младшую первой
+RingPolynomial::RingPolynomial(const FiniteRingRules& rules, const string& coefficients)
+    : rules_(&rules) {
+    if (coefficients.empty()) {
+        throw runtime_error("Cannot create RingPolynomial from empty string");
+    }
+    coefficients_.reserve(coefficients.size());
+    for (auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+        const int v = rules_->lookupIndex(*it);
+        if (v == FiniteRingRules::INVALID_INDEX) {
+            throw runtime_error("Invalid symbol in RingPolynomial constructor: " + string(1, *it));
+        }
+        coefficients_.push_back(static_cast<uint8_t>(v));
+    }
+    normalize();
+}
+
+RingPolynomial::RingPolynomial(const FiniteRingRules& rules, vector<uint8_t> coefficients)
+    : rules_(&rules), coefficients_(std::move(coefficients)) {
+    const int n = rules_->getSize();
+    for (uint8_t c : coefficients_) {
+        if (c >= n) {
+            throw runtime_error("Coefficient index out of range: " + std::to_string(c));
+        }
+    }
+    normalize();
+}
+
+RingPolynomial RingPolynomial::fromRingNumber(const RingNumber& num) {
+    const DigitBuffer& digits = num.getValues();
+    return RingPolynomial(num.getRules(), vector<uint8_t>(digits.begin(), digits.end()));
+}
+
+RingNumber RingPolynomial::toRingNumber() const {
+    if (coefficients_.empty()) {
+        return RingNumber(*rules_);
+    }
+    return RingNumber(*rules_, coefficients_);
+}
+
+string RingPolynomial::toString() const {
+    if (coefficients_.empty()) {
+        return string(1, rules_->getZeroElement());
+    }
+    const vector<char>& alphabet = rules_->getOrderedValues();
+    string result;
+    result.reserve(coefficients_.size());
+    for (size_t i = coefficients_.size(); i > 0; --i) {
+        result.push_back(alphabet[coefficients_[i - 1]]);
+    }
+    return result;
+}
+
+bool RingPolynomial::operator==(const RingPolynomial& other) const {
+    return rules_ == other.rules_ && coefficients_ == other.coefficients_;
+}
+
+void RingPolynomial::normalize() {
+    while (!coefficients_.empty() && coefficients_.back() == 0) {
+        coefficients_.pop_back();
+    }
+}
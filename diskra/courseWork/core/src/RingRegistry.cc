@@ -0,0 +1,77 @@
+// core/src/RingRegistry.cc
+#include "RingRegistry.h"
+#include <stdexcept>
+#include <map>
+#include <mutex>
+
+using std::string;
+using std::runtime_error;
+
+RingRegistry::RingRegistry(const string& config_file)
+    : config_file_(config_file) {
+    YAML::Node root;
+
+    try {
+        root = YAML::LoadFile(config_file);
+    } catch (const YAML::Exception& e) {
+        throw runtime_error("Failed to load config file '" + config_file + "': " + e.what());
+    }
+
+    if (!root["variants"]) {
+        throw runtime_error("Config missing 'variants' section");
+    }
+
+    // * один проход по дереву: каждый вариант сразу строится и проверяется
+    for (const auto& type_node : root["variants"]) {
+        const string group = type_node.first.as<string>();
+        for (const auto& var_node : type_node.second) {
+            const string name = var_node.first.as<string>();
+            if (entries_.count(name) != 0) {
+                throw runtime_error("Duplicate variant name: '" + name + "'");
+            }
+
+            std::shared_ptr<const FiniteRingRules> rules;
+            try {
+                rules = std::make_shared<const FiniteRingRules>(var_node.second);
+            } catch (const std::exception& e) {
+                throw runtime_error("Invalid variant '" + name + "': " + e.what());
+            }
+
+            entries_.emplace(name, Entry{group, std::move(rules)});
+            names_.push_back(name);
+        }
+    }
+}
+
+const RingRegistry& RingRegistry::instance(const string& config_file) {
+    // реестры живут до конца процесса, ссылки на них не протухают
+    static std::mutex mutex;
+    static std::map<string, std::unique_ptr<RingRegistry>> registries;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<RingRegistry>& slot = registries[config_file];
+    if (!slot) {
+        slot = std::make_unique<RingRegistry>(config_file);
+    }
+    return *slot;
+}
+
+std::shared_ptr<const FiniteRingRules> RingRegistry::get(const string& variant_name) const {
+    return find(variant_name).rules;
+}
+
+bool RingRegistry::contains(const string& variant_name) const {
+    return entries_.count(variant_name) != 0;
+}
+
+const string& RingRegistry::getGroup(const string& variant_name) const {
+    return find(variant_name).group;
+}
+
+const RingRegistry::Entry& RingRegistry::find(const string& variant_name) const {
+    auto it = entries_.find(variant_name);
+    if (it == entries_.end()) {
+        throw runtime_error("Variant not found: '" + variant_name + "'");
+    }
+    return it->second;
+}
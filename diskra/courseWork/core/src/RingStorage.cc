@@ -0,0 +1,447 @@
+// core/src/RingStorage.cc
+#include "RingStorage.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+
+namespace {
+
+const char kMagic[4] = {'R', 'N', 'G', 'S'};
+const char kTrailerMagic[4] = {'R', 'N', 'G', 'X'};
+const uint16_t kVersion = 1;
+// * запись индекса на каждые 64 записи
+const uint64_t kIndexStride = 64;
+// * хвост: число записей, смещение индекса, метка, резерв
+const size_t kTrailerSize = 8 + 8 + 4 + 4;
+// * блок буфера чтения и записи
+const size_t kBlock = 1 << 16;
+
+unsigned bitsFor(int size) {
+    unsigned bits = 1;
+    while ((1 << bits) < size) {
+        ++bits;
+    }
+    return bits;
+}
+
+size_t packedBytes(size_t digits, unsigned bits) {
+    return (digits * bits + 7) / 8;
+}
+
+// * --- LITTLE-ENDIAN ---
+void appendU16(string& out, uint16_t value) {
+    out.push_back(static_cast<char>(value & 0xFF));
+    out.push_back(static_cast<char>(value >> 8));
+}
+
+void appendU64(string& out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+uint64_t loadLE(const uint8_t* p, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        value |= static_cast<uint64_t>(p[i]) << (8 * i);
+    }
+    return value;
+}
+
+void appendVarint(string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+// * --- УПАКОВКА ЦИФР: поток по bits бит, младшая цифра в младших битах ---
+void packDigits(string& out, const DigitBuffer& digits, unsigned bits) {
+    uint64_t acc = 0;
+    unsigned filled = 0;
+    for (uint8_t d : digits) {
+        acc |= static_cast<uint64_t>(d) << filled;
+        filled += bits;
+        while (filled >= 8) {
+            out.push_back(static_cast<char>(acc & 0xFF));
+            acc >>= 8;
+            filled -= 8;
+        }
+    }
+    if (filled > 0) {
+        out.push_back(static_cast<char>(acc & 0xFF));
+    }
+}
+
+void unpackDigits(const uint8_t* packed, size_t count, unsigned bits, DigitBuffer& digits) {
+    digits.resize(count);
+    const uint64_t mask = (uint64_t(1) << bits) - 1;
+    uint64_t acc = 0;
+    unsigned filled = 0;
+    for (size_t i = 0; i < count; ++i) {
+        while (filled < bits) {
+            acc |= static_cast<uint64_t>(*packed++) << filled;
+            filled += 8;
+        }
+        digits[i] = static_cast<uint8_t>(acc & mask);
+        acc >>= bits;
+        filled -= bits;
+    }
+}
+
+// * заголовок целиком (читатели проверяют его тем же кодом)
+string encodeHeader(const FiniteRingRules& rules, const string& variant_name) {
+    if (variant_name.size() > UINT16_MAX) {
+        throw runtime_error("Variant name is too long");
+    }
+    const vector<char>& alphabet = rules.getOrderedValues();
+    string out(kMagic, sizeof(kMagic));
+    appendU16(out, kVersion);
+    out.push_back(static_cast<char>(rules.getSize()));
+    out.push_back(static_cast<char>(bitsFor(rules.getSize())));
+    appendU16(out, static_cast<uint16_t>(variant_name.size()));
+    out += variant_name;
+    out.append(alphabet.begin(), alphabet.end());
+    return out;
+}
+
+// read(dst, n) - следующие n байт заголовка
+template <typename Read>
+StorageHeader decodeHeader(Read read, const FiniteRingRules& rules) {
+    uint8_t fixed[10];
+    read(fixed, sizeof(fixed));
+    if (std::memcmp(fixed, kMagic, sizeof(kMagic)) != 0) {
+        throw runtime_error("Not a ring storage file: bad magic");
+    }
+    const uint16_t version = static_cast<uint16_t>(loadLE(fixed + 4, 2));
+    if (version != kVersion) {
+        throw runtime_error("Unsupported ring storage version: " + std::to_string(version));
+    }
+
+    StorageHeader header;
+    header.size = fixed[6];
+    header.bits = fixed[7];
+    header.variant.resize(loadLE(fixed + 8, 2));
+    read(reinterpret_cast<uint8_t*>(&header.variant[0]), header.variant.size());
+    header.alphabet.resize(static_cast<size_t>(header.size));
+    read(reinterpret_cast<uint8_t*>(&header.alphabet[0]), header.alphabet.size());
+
+    const vector<char>& alphabet = rules.getOrderedValues();
+    if (header.size != rules.getSize() || header.bits != bitsFor(header.size) ||
+        !std::equal(alphabet.begin(), alphabet.end(), header.alphabet.begin(), header.alphabet.end())) {
+        throw runtime_error("Ring storage variant mismatch: file holds '" + header.variant +
+                            "' (Z" + std::to_string(header.size) + ")");
+    }
+    return header;
+}
+
+[[noreturn]] void throwTruncated() {
+    throw runtime_error("Unexpected end of ring storage");
+}
+
+}  // namespace
+
+// * --- ЗАПИСЬ ---
+RingStorageWriter::RingStorageWriter(std::ostream& out, const FiniteRingRules& rules, const string& variant_name)
+    : out_(out), rules_(rules), bits_(bitsFor(rules.getSize())) {
+    writeHeader(variant_name);
+}
+
+RingStorageWriter::RingStorageWriter(const string& path, const FiniteRingRules& rules, const string& variant_name)
+    : file_(std::make_unique<std::ofstream>(path, std::ios::binary)),
+      out_(*file_), rules_(rules), bits_(bitsFor(rules.getSize())) {
+    if (!*file_) {
+        throw runtime_error("Cannot open output file: " + path);
+    }
+    writeHeader(variant_name);
+}
+
+RingStorageWriter::~RingStorageWriter() {
+    try {
+        close();
+    } catch (...) {
+    }
+}
+
+void RingStorageWriter::writeHeader(const string& variant_name) {
+    buffer_ = encodeHeader(rules_, variant_name);
+    buffer_.reserve(kBlock + 64);
+    offset_ = buffer_.size();
+}
+
+void RingStorageWriter::write(const RingNumber& num) {
+    if (closed_) {
+        throw runtime_error("Ring storage writer is closed");
+    }
+    if (num.getRules().getSize() != rules_.getSize()) {
+        throw runtime_error("Ring size mismatch: expected " + std::to_string(rules_.getSize()) +
+                            ", got " + std::to_string(num.getRules().getSize()));
+    }
+    if (count_ % kIndexStride == 0) {
+        index_.push_back(offset_);
+    }
+
+    const size_t before = buffer_.size();
+    const DigitBuffer& digits = num.getValues();
+    appendVarint(buffer_, (static_cast<uint64_t>(digits.size()) << 1) | (num.isNegative() ? 1 : 0));
+    packDigits(buffer_, digits, bits_);
+    offset_ += buffer_.size() - before;
+    ++count_;
+
+    if (buffer_.size() >= kBlock) {
+        flush();
+    }
+}
+
+void RingStorageWriter::writeMany(const vector<RingNumber>& nums) {
+    for (const RingNumber& num : nums) {
+        write(num);
+    }
+}
+
+void RingStorageWriter::close() {
+    if (closed_) {
+        return;
+    }
+    closed_ = true;
+
+    // конец записей, индекс блоков и хвост
+    buffer_.push_back(0);
+    const uint64_t index_offset = offset_ + 1;
+    for (uint64_t offset : index_) {
+        appendU64(buffer_, offset);
+    }
+    appendU64(buffer_, count_);
+    appendU64(buffer_, index_offset);
+    buffer_.append(kTrailerMagic, sizeof(kTrailerMagic));
+    buffer_.append(4, '\0');
+    flush();
+    out_.flush();
+    if (!out_) {
+        throw runtime_error("Failed to write ring storage");
+    }
+    if (file_) {
+        file_->close();
+    }
+}
+
+void RingStorageWriter::flush() {
+    out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+}
+
+// * --- ПОТОКОВОЕ ЧТЕНИЕ ---
+RingStorageReader::RingStorageReader(std::istream& in, const FiniteRingRules& rules)
+    : in_(in), rules_(rules), buffer_(kBlock) {
+    header_ = decodeHeader([this](uint8_t* out, size_t count) { readBytes(out, count); }, rules_);
+}
+
+RingStorageReader::RingStorageReader(const string& path, const FiniteRingRules& rules)
+    : file_(std::make_unique<std::ifstream>(path, std::ios::binary)),
+      in_(*file_), rules_(rules), buffer_(kBlock) {
+    if (!*file_) {
+        throw runtime_error("Cannot open input file: " + path);
+    }
+    header_ = decodeHeader([this](uint8_t* out, size_t count) { readBytes(out, count); }, rules_);
+}
+
+bool RingStorageReader::next(RingNumber& num) {
+    if (finished_) {
+        return false;
+    }
+    uint64_t tag = 0;
+    for (unsigned shift = 0;; shift += 7) {
+        if (shift >= 64) {
+            throw runtime_error("Corrupted ring storage record");
+        }
+        const uint8_t byte = readByte();
+        tag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+    if (tag == 0) {
+        finished_ = true;
+        return false;
+    }
+
+    const size_t length = static_cast<size_t>(tag >> 1);
+    uint8_t packed[256];
+    vector<uint8_t> large;
+    const size_t bytes = packedBytes(length, header_.bits);
+    uint8_t* target = packed;
+    if (bytes > sizeof(packed)) {
+        large.resize(bytes);
+        target = large.data();
+    }
+    readBytes(target, bytes);
+
+    DigitBuffer digits;
+    unpackDigits(target, length, header_.bits, digits);
+    num = RingNumber(rules_, std::move(digits), (tag & 1) != 0);
+    return true;
+}
+
+vector<RingNumber> RingStorageReader::readMany(size_t max_count) {
+    vector<RingNumber> result;
+    RingNumber num(rules_);
+    while (result.size() < max_count && next(num)) {
+        result.push_back(num);
+    }
+    return result;
+}
+
+uint8_t RingStorageReader::readByte() {
+    uint8_t byte;
+    readBytes(&byte, 1);
+    return byte;
+}
+
+void RingStorageReader::readBytes(uint8_t* out, size_t count) {
+    while (count > 0) {
+        if (position_ == filled_) {
+            in_.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+            filled_ = static_cast<size_t>(in_.gcount());
+            position_ = 0;
+            if (filled_ == 0) {
+                throwTruncated();
+            }
+        }
+        const size_t take = std::min(count, filled_ - position_);
+        std::memcpy(out, buffer_.data() + position_, take);
+        position_ += take;
+        out += take;
+        count -= take;
+    }
+}
+
+// * --- ПРОИЗВОЛЬНЫЙ ДОСТУП ---
+MappedRingStorage::MappedRingStorage(const string& path, const FiniteRingRules& rules) : rules_(rules) {
+#ifndef _WIN32
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error("Cannot open input file: " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw runtime_error("Cannot stat input file: " + path);
+    }
+    length_ = static_cast<size_t>(info.st_size);
+    if (length_ > 0) {
+        void* mapping = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            throw runtime_error("Cannot map input file: " + path);
+        }
+        data_ = static_cast<const uint8_t*>(mapping);
+        mapped_ = true;
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw runtime_error("Cannot open input file: " + path);
+    }
+    fallback_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = fallback_.data();
+    length_ = fallback_.size();
+#endif
+
+    try {
+        size_t cursor = 0;
+        header_ = decodeHeader([this, &cursor](uint8_t* out, size_t count) {
+            if (cursor + count > length_) {
+                throwTruncated();
+            }
+            std::memcpy(out, data_ + cursor, count);
+            cursor += count;
+        }, rules_);
+        records_offset_ = cursor;
+
+        if (length_ < cursor + 1 + kTrailerSize) {
+            throwTruncated();
+        }
+        const uint8_t* trailer = data_ + length_ - kTrailerSize;
+        if (std::memcmp(trailer + 16, kTrailerMagic, sizeof(kTrailerMagic)) != 0) {
+            throw runtime_error("Ring storage has no index (writer was not closed?)");
+        }
+        count_ = loadLE(trailer, 8);
+        index_offset_ = loadLE(trailer + 8, 8);
+        // смещение из файла: сначала границы, потом вычитание без заворота
+        const uint64_t index_end = length_ - kTrailerSize;
+        const uint64_t blocks = count_ / kIndexStride + (count_ % kIndexStride != 0 ? 1 : 0);
+        if (index_offset_ < records_offset_ + 1 || index_offset_ > index_end ||
+            blocks > (index_end - index_offset_) / 8) {
+            throw runtime_error("Corrupted ring storage index");
+        }
+    } catch (...) {
+#ifndef _WIN32
+        if (mapped_) {
+            ::munmap(const_cast<uint8_t*>(data_), length_);
+        }
+#endif
+        throw;
+    }
+}
+
+MappedRingStorage::~MappedRingStorage() {
+#ifndef _WIN32
+    if (mapped_) {
+        ::munmap(const_cast<uint8_t*>(data_), length_);
+    }
+#endif
+}
+
+RingNumber MappedRingStorage::at(uint64_t index) const {
+    if (index >= count_) {
+        throw std::out_of_range("Record index " + std::to_string(index) + " out of range (" +
+                                std::to_string(count_) + " records)");
+    }
+
+    // начало блока из индекса, затем пропуск записей по их длинам
+    const uint64_t start = loadLE(data_ + index_offset_ + (index / kIndexStride) * 8, 8);
+    if (start < records_offset_ || start >= index_offset_) {
+        throw runtime_error("Corrupted ring storage index");
+    }
+    const uint8_t* p = data_ + start;
+    const uint8_t* end = data_ + index_offset_;
+    uint64_t tag = 0;
+    for (uint64_t skip = index % kIndexStride;; --skip) {
+        tag = 0;
+        for (unsigned shift = 0;; shift += 7) {
+            if (p == end || shift >= 64) {
+                throw runtime_error("Corrupted ring storage record");
+            }
+            const uint8_t byte = *p++;
+            tag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                break;
+            }
+        }
+        const size_t bytes = packedBytes(static_cast<size_t>(tag >> 1), header_.bits);
+        if (tag == 0 || static_cast<size_t>(end - p) < bytes) {
+            throw runtime_error("Corrupted ring storage record");
+        }
+        if (skip == 0) {
+            break;
+        }
+        p += bytes;
+    }
+
+    DigitBuffer digits;
+    unpackDigits(p, static_cast<size_t>(tag >> 1), header_.bits, digits);
+    return RingNumber(rules_, std::move(digits), (tag & 1) != 0);
+}
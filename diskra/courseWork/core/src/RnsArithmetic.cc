@@ -0,0 +1,341 @@
+// core/src/RnsArithmetic.cc
+#include "RnsArithmetic.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+namespace {
+
+// * элементов на задачу при переводе пакетов
+const uint64_t kConvertGrain = 16;
+
+// число кольца из машинного целого (цифры - индексы)
+RingNumber fromInteger(const FiniteRingRules& rules, uint64_t value) {
+    const uint64_t n = static_cast<uint64_t>(rules.getSize());
+    DigitBuffer digits;
+    do {
+        digits.push_back(static_cast<uint8_t>(value % n));
+        value /= n;
+    } while (value != 0);
+    return RingNumber(rules, std::move(digits));
+}
+
+// младшие digits цифр модуля (приведение по N^digits)
+RingNumber lowDigits(const RingNumber& num, size_t digits) {
+    const DigitBuffer& values = num.getValues();
+    if (values.size() <= digits) {
+        return num;
+    }
+    RingNumber result(num.getRules(), DigitBuffer(values.data(), digits), num.isNegative());
+    result.normalize();
+    return result;
+}
+
+}  // namespace
+
+RnsArithmetic::Ring::Ring(shared_ptr<const FiniteRingRules> ring_rules)
+    : rules(std::move(ring_rules)),
+      small(std::make_unique<SmallRingArithmetic>(*rules)),
+      big(std::make_unique<BigRingArithmetic>(*rules, *small)) {}
+
+// * --- КОНСТРУКТОРЫ: каналы и константы КТО ---
+RnsArithmetic::RnsArithmetic(vector<RnsChannel> channels, shared_ptr<const FiniteRingRules> output,
+                             unsigned threads)
+    : output_(std::move(output)),
+      out_(output_),
+      modulus_(*output_, DigitBuffer{1}),
+      half_(*output_) {
+    if (channels.empty()) {
+        throw std::runtime_error("RNS requires at least one channel");
+    }
+    channels_.reserve(channels.size());
+    for (RnsChannel& channel : channels) {
+        const size_t digits = channel.digits != 0
+            ? channel.digits
+            : static_cast<size_t>(channel.rules->getDigitsPerLimb());
+        DigitBuffer modulus(digits + 1);
+        modulus[digits] = 1;
+        const FiniteRingRules& rules = *channel.rules;
+        channels_.push_back(Channel{Ring(std::move(channel.rules)), digits,
+                                    RingNumber(rules, std::move(modulus))});
+    }
+
+    // модули N_i^k_i взаимно просты ровно когда взаимно просты N_i
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        for (size_t j = i + 1; j < channels_.size(); ++j) {
+            const int ni = channels_[i].ring.rules->getSize();
+            const int nj = channels_[j].ring.rules->getSize();
+            if (std::gcd(ni, nj) != 1) {
+                throw std::runtime_error("RNS channel moduli must be pairwise coprime: Z" +
+                                         std::to_string(ni) + " and Z" + std::to_string(nj));
+            }
+        }
+    }
+
+    const BigRingArithmetic& big = *out_.big;
+    for (const Channel& channel : channels_) {
+        const RingNumber base = fromInteger(*output_, static_cast<uint64_t>(channel.ring.rules->getSize()));
+        channel_moduli_.push_back(big.pow(base, static_cast<uint64_t>(channel.digits)));
+        modulus_ = big.multiply(modulus_, channel_moduli_.back());
+    }
+    half_ = big.divide(modulus_, fromInteger(*output_, 2)).quotient;
+
+    // M_i * (M_i^-1 mod m_i) < M, приводить по M не нужно
+    for (const RingNumber& m : channel_moduli_) {
+        const RingNumber mi = big.divide(modulus_, m).quotient;
+        crt_terms_.push_back(big.multiply(mi, big.modInverse(mi, m)));
+    }
+
+    pool_ = std::make_unique<WorkStealingPool>(threads);
+}
+
+RnsArithmetic::RnsArithmetic(const RingRegistry& registry,
+                             const vector<std::pair<string, size_t>>& channels,
+                             const string& output_variant, unsigned threads)
+    : RnsArithmetic(
+          [&registry, &channels] {
+              vector<RnsChannel> result;
+              for (const auto& [name, digits] : channels) {
+                  result.push_back(RnsChannel{registry.get(name), digits});
+              }
+              return result;
+          }(),
+          registry.get(output_variant), threads) {}
+
+RnsArithmetic::~RnsArithmetic() = default;
+
+// * --- ДОСТУП ---
+const FiniteRingRules& RnsArithmetic::channelRules(size_t channel) const {
+    return *channels_.at(channel).ring.rules;
+}
+
+size_t RnsArithmetic::channelDigits(size_t channel) const {
+    return channels_.at(channel).digits;
+}
+
+const RingNumber& RnsArithmetic::getModulus() const {
+    return modulus_;
+}
+
+RingNumber RnsArithmetic::channelModulus(size_t channel) const {
+    return channel_moduli_.at(channel);
+}
+
+// * --- ПЕРЕВОД ---
+RnsNumber RnsArithmetic::fromRingNumber(const RingNumber& num) const {
+    const RingNumber magnitude = num.withoutSign();
+    const bool negative = num.isNegative() && !magnitude.isZero();
+
+    // диапазон: [-(M - 1) / 2 .. M / 2], то есть |x| <= half или |x| < M - half
+    const BigRingArithmetic& big = *out_.big;
+    const RingNumber value = convert(magnitude, out_, 0);
+    const RingNumber limit = negative ? big.subtract(modulus_, half_) : half_;
+    const RingNumber excess = big.subtract(value, limit);
+    if (negative ? !excess.isNegative() : (!excess.isNegative() && !excess.isZero())) {
+        throw std::runtime_error("Number out of RNS range: " + num.toString());
+    }
+
+    RnsNumber result;
+    result.residues.reserve(channels_.size());
+    for (size_t c = 0; c < channels_.size(); ++c) {
+        result.residues.push_back(channelResidue(c, magnitude, negative));
+    }
+    return result;
+}
+
+RingNumber RnsArithmetic::toRingNumber(const RnsNumber& num) const {
+    checkShape(num);
+    const BigRingArithmetic& big = *out_.big;
+    RingNumber sum(*output_);
+    for (size_t c = 0; c < channels_.size(); ++c) {
+        sum = big.add(sum, big.multiply(convert(num.residues[c], out_, 0), crt_terms_[c]));
+    }
+    RingNumber value = big.divide(sum, modulus_).remainder;
+
+    // больше M / 2 - отрицательное число
+    const RingNumber excess = big.subtract(value, half_);
+    if (!excess.isNegative() && !excess.isZero()) {
+        value = big.subtract(value, modulus_);
+    }
+    return value;
+}
+
+vector<RnsNumber> RnsArithmetic::fromRingNumbers(const vector<RingNumber>& nums) const {
+    vector<RnsNumber> result(nums.size());
+    pool_->parallelFor(nums.size(), kConvertGrain, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t i = begin; i < end; ++i) {
+            result[i] = fromRingNumber(nums[i]);
+        }
+        return true;
+    });
+    return result;
+}
+
+vector<RingNumber> RnsArithmetic::toRingNumbers(const vector<RnsNumber>& nums) const {
+    vector<RingNumber> result(nums.size(), RingNumber(*output_));
+    pool_->parallelFor(nums.size(), kConvertGrain, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t i = begin; i < end; ++i) {
+            result[i] = toRingNumber(nums[i]);
+        }
+        return true;
+    });
+    return result;
+}
+
+// * --- АРИФМЕТИКА ---
+RnsNumber RnsArithmetic::add(const RnsNumber& a, const RnsNumber& b) const {
+    return apply(Op::Add, a, b);
+}
+
+RnsNumber RnsArithmetic::subtract(const RnsNumber& a, const RnsNumber& b) const {
+    return apply(Op::Subtract, a, b);
+}
+
+RnsNumber RnsArithmetic::multiply(const RnsNumber& a, const RnsNumber& b) const {
+    return apply(Op::Multiply, a, b);
+}
+
+RnsNumber RnsArithmetic::negate(const RnsNumber& a) const {
+    checkShape(a);
+    RnsNumber result;
+    result.residues.reserve(channels_.size());
+    for (size_t c = 0; c < channels_.size(); ++c) {
+        result.residues.push_back(channelNegate(c, a.residues[c]));
+    }
+    return result;
+}
+
+vector<RnsNumber> RnsArithmetic::addMany(const vector<RnsNumber>& a, const vector<RnsNumber>& b) const {
+    return applyMany(Op::Add, a, b);
+}
+
+vector<RnsNumber> RnsArithmetic::multiplyMany(const vector<RnsNumber>& a, const vector<RnsNumber>& b) const {
+    return applyMany(Op::Multiply, a, b);
+}
+
+// * --- КАНАЛЫ ---
+// остатки неотрицательны и короче digits цифр, результат - тоже
+RingNumber RnsArithmetic::channelOp(size_t channel, Op op, const RingNumber& a, const RingNumber& b) const {
+    const Channel& ch = channels_[channel];
+    const BigRingArithmetic& big = *ch.ring.big;
+    switch (op) {
+        case Op::Add:
+            return lowDigits(big.add(a, b), ch.digits);
+        case Op::Subtract: {
+            RingNumber diff = big.subtract(a, b);
+            return diff.isNegative() ? big.add(diff, ch.modulus) : diff;
+        }
+        case Op::Multiply:
+            return lowDigits(big.multiply(a, b), ch.digits);
+    }
+    throw std::runtime_error("Unknown RNS operation");
+}
+
+RingNumber RnsArithmetic::channelNegate(size_t channel, const RingNumber& a) const {
+    const Channel& ch = channels_[channel];
+    return a.isZero() ? a : ch.ring.big->subtract(ch.modulus, a);
+}
+
+RnsNumber RnsArithmetic::apply(Op op, const RnsNumber& a, const RnsNumber& b) const {
+    checkShape(a);
+    checkShape(b);
+    // каналы в десятки цифр: будить пул ради одной операции дороже, чем посчитать подряд
+    RnsNumber result;
+    result.residues.reserve(channels_.size());
+    for (size_t c = 0; c < channels_.size(); ++c) {
+        result.residues.push_back(channelOp(c, op, a.residues[c], b.residues[c]));
+    }
+    return result;
+}
+
+vector<RnsNumber> RnsArithmetic::applyMany(Op op, const vector<RnsNumber>& a, const vector<RnsNumber>& b) const {
+    if (a.size() != b.size()) {
+        throw std::runtime_error("RNS batch size mismatch: " + std::to_string(a.size()) +
+                                 " vs " + std::to_string(b.size()));
+    }
+    const size_t count = channels_.size();
+    vector<RnsNumber> result(a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        checkShape(a[i]);
+        checkShape(b[i]);
+        result[i].residues.reserve(count);
+        for (const Channel& channel : channels_) {
+            result[i].residues.emplace_back(*channel.ring.rules);
+        }
+    }
+
+    // задача - пара (элемент, канал): каналы одного элемента независимы
+    const uint64_t grain = std::max<uint64_t>(1, 256 / count);
+    pool_->parallelFor(a.size() * count, grain, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t task = begin; task < end; ++task) {
+            const size_t i = task / count;
+            const size_t c = task % count;
+            result[i].residues[c] = channelOp(c, op, a[i].residues[c], b[i].residues[c]);
+        }
+        return true;
+    });
+    return result;
+}
+
+// * --- СМЕНА ОСНОВАНИЯ ---
+// Горнер по limb'ам исходного кольца: limb в int64, затем
+// r = r * N_src^limb + limb в кольце target (с обрезкой, если keep_digits)
+RingNumber RnsArithmetic::convert(const RingNumber& num, const Ring& target, size_t keep_digits) const {
+    const FiniteRingRules& source = num.getRules();
+    const DigitBuffer& digits = num.getValues();
+    if (source.getSize() == target.rules->getSize()) {
+        RingNumber result(*target.rules, digits);
+        result.normalize();
+        return keep_digits != 0 ? lowDigits(result, keep_digits) : result;
+    }
+
+    const uint64_t n = static_cast<uint64_t>(source.getSize());
+    const size_t limb = static_cast<size_t>(source.getDigitsPerLimb());
+    uint64_t limb_base = 1;
+    for (size_t i = 0; i < limb; ++i) {
+        limb_base *= n;
+    }
+    const RingNumber base = fromInteger(*target.rules, limb_base);
+
+    const BigRingArithmetic& big = *target.big;
+    RingNumber result(*target.rules);
+    const size_t limbs = (digits.size() + limb - 1) / limb;
+    for (size_t l = limbs; l > 0; --l) {
+        const size_t begin = (l - 1) * limb;
+        const size_t end = std::min(digits.size(), begin + limb);
+        uint64_t value = 0;
+        for (size_t i = end; i > begin; --i) {
+            value = value * n + digits[i - 1];
+        }
+        if (!result.isZero()) {
+            result = big.multiply(result, base);
+        }
+        result = big.add(result, fromInteger(*target.rules, value));
+        if (keep_digits != 0) {
+            result = lowDigits(result, keep_digits);
+        }
+    }
+    return result;
+}
+
+RingNumber RnsArithmetic::channelResidue(size_t channel, const RingNumber& magnitude, bool negative) const {
+    const Channel& ch = channels_[channel];
+    RingNumber residue = convert(magnitude, ch.ring, ch.digits);
+    return negative ? channelNegate(channel, residue) : residue;
+}
+
+void RnsArithmetic::checkShape(const RnsNumber& num) const {
+    if (num.residues.size() != channels_.size()) {
+        throw std::runtime_error("RNS number has " + std::to_string(num.residues.size()) +
+                                 " residues, expected " + std::to_string(channels_.size()));
+    }
+    for (size_t c = 0; c < channels_.size(); ++c) {
+        if (num.residues[c].getRules().getSize() != channels_[c].ring.rules->getSize()) {
+            throw std::runtime_error("RNS residue " + std::to_string(c) + " belongs to another ring");
+        }
+    }
+}
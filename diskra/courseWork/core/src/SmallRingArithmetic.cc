@@ -1,139 +1,70 @@
 // core/src/SmallRingArithmetic.cc
 #include "SmallRingArithmetic.h"
 #include <stdexcept>
-#include <stack>
-#include <utility>
+#include <string>
 
-char SmallRingArithmetic::plusOne(char c) const {
-    // 1. получаем упорядоченный список символов кольца
-    const std::vector<char>& values = rules_.getOrderedValues(); 
-    
-    // 2. находим позицию текущего символа c (O(N))
-    auto it = std::find(values.begin(), values.end(), c);
+// ! все операции идут через таблицы Кэли из FiniteRingRules:
+// ! символ -> индекс, одна выборка из таблицы, индекс -> символ
 
+char SmallRingArithmetic::plusOne(char c) const {
     // проверка на ошибку
-    if (it == values.end()) {
+    int v = rules_.lookupIndex(c);
+    if (v == FiniteRingRules::INVALID_INDEX) {
         throw std::runtime_error("Invalid ring character found.");
     }
 
-    // 3. продвигаем итератор на одну позицию
-    auto next_it = std::next(it);
-
-    // 4. проверка цикличности: если достигли конца, возвращаемся к началу
-    if (next_it == values.end()) {
-        // циклический переход с N-1 на 0
-        return values.front();
-    }
-
-    // 5. возвращаем следующий элемент
-    return *next_it;
+    // следующий по циклу индекс, с N-1 возвращаемся к 0
+    return rules_.getValueChar((v + 1) % size_);
 }
 
 char SmallRingArithmetic::add(char a, char b) const {
-    const char zero = rules_.getZeroElement();
-    
-    if (b == zero) {
-        return a;
-    }
-
-    char counter = zero;
-    char result = a;
-    
-    // итерация b раз, используя char как счетчик
-    while (counter != b) {
-        result = plusOne(result);
-        counter = plusOne(counter); //  продвигаем счетчик
-    }
-    return result;
+    uint8_t va = static_cast<uint8_t>(rules_.getCharValue(a));
+    uint8_t vb = static_cast<uint8_t>(rules_.getCharValue(b));
+    return rules_.getValueChar(addIndex(va, vb));
 }
 
-
 char SmallRingArithmetic::subtract(char a, char b) const {
-    // ? вариант разницы индексов O(1)
-    // int va = rules_.getCharValue(a);
-    // int vb = rules_.getCharValue(b);
-    // int n = rules_.getSize();
-    
-    // // Вычитаем с учетом модуля
-    // int result_index = (va - vb + n) % n;
-    
-    // return rules_.getValueChar(result_index);
-
-    // ! вариант через сложение с обратным (N))
-    char neg_b = findAdditiveInverse(b); 
-    return add(a, neg_b);
+    // таблица вычитания построена как сложение с обратным
+    uint8_t va = static_cast<uint8_t>(rules_.getCharValue(a));
+    uint8_t vb = static_cast<uint8_t>(rules_.getCharValue(b));
+    return rules_.getValueChar(subtractIndex(va, vb));
 }
 
 char SmallRingArithmetic::multiply(char a, char b) const {
-    const char zero = rules_.getZeroElement();
-    const char one = rules_.getOneElement();
-    
-    if (a == zero || b == zero) return zero;
-    
-    // используем b как счетчик, уменьшая его до нуля.
-    char result = zero;
-    char counter = b;
-    
-    while (counter != zero) {
-        // result = result + a
-        result = add(result, a); 
-        
-        // counter = counter - 1
-        counter = subtract(counter, one); 
-    }
-    
-    return result;
+    uint8_t va = static_cast<uint8_t>(rules_.getCharValue(a));
+    uint8_t vb = static_cast<uint8_t>(rules_.getCharValue(b));
+    return rules_.getValueChar(multiplyIndex(va, vb));
 }
 
 char SmallRingArithmetic::divide(char a, char b) const {
     const char zero = rules_.getZeroElement();
-    
+
     // деление на ноль
     if (b == zero) {
         throw std::runtime_error("Division by zero");
     }
-    
+
     // находим обратный элемент
     char inv = findMultiplicativeInverse(b);
     return multiply(a, inv);
 }
 
 char SmallRingArithmetic::findAdditiveInverse(char element) const {
-    const char zero = rules_.getZeroElement();
-    
-    if (element == zero) {
-        return zero;
-    }
-    
-    char candidate = zero;
-    do {
-        char sum = add(element, candidate);
-        if (sum == zero) {
-            return candidate;
-        }
-        candidate = plusOne(candidate);
-    } while (candidate != zero);
-    
-    throw std::runtime_error("Additive inverse logic error: Full circle without result."); 
+    int v = rules_.getCharValue(element);
+    return rules_.getValueChar(rules_.getNegTable()[v]);
 }
 
 char SmallRingArithmetic::findMultiplicativeInverse(char element) const {
     const char zero = rules_.getZeroElement();
-    const char one = rules_.getOneElement();
-    
+
     if (element == zero) {
         throw std::runtime_error("Zero has no multiplicative inverse");
     }
 
-    char candidate = one;
-    do {
-        char product = multiply(element, candidate);
-        if (product == one) {
-            return candidate;
-        }
-        candidate = plusOne(candidate);
-    } while (candidate != one);
-    
-    throw std::runtime_error("No multiplicative inverse for element: " + 
-                           std::string(1, element));
-}
\ No newline at end of file
+    uint8_t inv = rules_.getInvTable()[rules_.getCharValue(element)];
+    if (inv == FiniteRingRules::NO_INVERSE) {
+        throw std::runtime_error("No multiplicative inverse for element: " +
+                               std::string(1, element));
+    }
+    return rules_.getValueChar(inv);
+}
@@ -0,0 +1,285 @@
+// core/src/SmallRingBatch.cc
+#include "SmallRingArithmetic.h"
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define RING_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+// * --- ПАКЕТНЫЕ ОПЕРАЦИИ НАД ИНДЕКСАМИ ---
+// векторное ядро обрабатывает префикс кратный ширине регистра и
+// возвращает его длину, хвост всегда досчитывается скалярно по таблицам.
+// сложение/вычитание: s = a + b, затем min(s, s - N) (работает для N <= 128);
+// умножение: по строке таблицы Кэли на каждое значение a, строка выбирается
+// перестановкой pshufb по b (нужно N <= 16); обратные - одна перестановка
+
+namespace {
+
+enum class BatchKernel { Scalar, Ssse3, Avx2 };
+
+BatchKernel detectKernel() {
+#ifdef RING_BATCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return BatchKernel::Avx2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return BatchKernel::Ssse3;
+    }
+#endif
+    return BatchKernel::Scalar;
+}
+
+BatchKernel activeKernel() {
+    static const BatchKernel kernel = detectKernel();
+    return kernel;
+}
+
+const int MAX_ADD_SIZE = 128;   // a + b ещё помещается в байт
+const int MAX_SHUFFLE_SIZE = 16; // таблица помещается в один pshufb
+
+#ifdef RING_BATCH_X86
+
+// строка таблицы, дополненная нулями до 16 байт
+__attribute__((target("ssse3")))
+__m128i loadRow(const uint8_t* row, int n) {
+    uint8_t padded[16] = {0};
+    std::memcpy(padded, row, static_cast<size_t>(n));
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(padded));
+}
+
+// * --- SSSE3: 16 цифр за шаг ---
+__attribute__((target("ssse3")))
+size_t addSsse3(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count, int n) {
+    const __m128i vn = _mm_set1_epi8(static_cast<char>(n));
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i sum = _mm_add_epi8(va, vb);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_min_epu8(sum, _mm_sub_epi8(sum, vn)));
+    }
+    return i;
+}
+
+__attribute__((target("ssse3")))
+size_t subSsse3(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count, int n) {
+    const __m128i vn = _mm_set1_epi8(static_cast<char>(n));
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i diff = _mm_sub_epi8(va, vb);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_min_epu8(diff, _mm_add_epi8(diff, vn)));
+    }
+    return i;
+}
+
+__attribute__((target("ssse3")))
+size_t mulSsse3(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count,
+                const uint8_t* table, int n) {
+    __m128i rows[MAX_SHUFFLE_SIZE];
+    for (int r = 0; r < n; ++r) {
+        rows[r] = loadRow(table + r * n, n);
+    }
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i acc = _mm_setzero_si128();
+        for (int r = 1; r < n; ++r) {   // строка нуля - одни нули
+            __m128i mask = _mm_cmpeq_epi8(va, _mm_set1_epi8(static_cast<char>(r)));
+            acc = _mm_or_si128(acc, _mm_and_si128(mask, _mm_shuffle_epi8(rows[r], vb)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), acc);
+    }
+    return i;
+}
+
+__attribute__((target("ssse3")))
+size_t lookupSsse3(const uint8_t* a, uint8_t* out, size_t count, const uint8_t* table, int n) {
+    const __m128i row = loadRow(table, n);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(row, va));
+    }
+    return i;
+}
+
+// * --- AVX2: 32 цифры за шаг (pshufb работает внутри 128-битных половин) ---
+__attribute__((target("avx2")))
+size_t addAvx2(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count, int n) {
+    const __m256i vn = _mm256_set1_epi8(static_cast<char>(n));
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i sum = _mm256_add_epi8(va, vb);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_min_epu8(sum, _mm256_sub_epi8(sum, vn)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t subAvx2(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count, int n) {
+    const __m256i vn = _mm256_set1_epi8(static_cast<char>(n));
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i diff = _mm256_sub_epi8(va, vb);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_min_epu8(diff, _mm256_add_epi8(diff, vn)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t mulAvx2(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count,
+               const uint8_t* table, int n) {
+    __m256i rows[MAX_SHUFFLE_SIZE];
+    for (int r = 0; r < n; ++r) {
+        rows[r] = _mm256_broadcastsi128_si256(loadRow(table + r * n, n));
+    }
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i acc = _mm256_setzero_si256();
+        for (int r = 1; r < n; ++r) {
+            __m256i mask = _mm256_cmpeq_epi8(va, _mm256_set1_epi8(static_cast<char>(r)));
+            acc = _mm256_or_si256(acc, _mm256_and_si256(mask, _mm256_shuffle_epi8(rows[r], vb)));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), acc);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t lookupAvx2(const uint8_t* a, uint8_t* out, size_t count, const uint8_t* table, int n) {
+    const __m256i row = _mm256_broadcastsi128_si256(loadRow(table, n));
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_shuffle_epi8(row, va));
+    }
+    return i;
+}
+
+#endif  // RING_BATCH_X86
+
+}  // namespace
+
+const char* SmallRingArithmetic::batchKernelName() {
+    switch (activeKernel()) {
+        case BatchKernel::Avx2:  return "avx2";
+        case BatchKernel::Ssse3: return "ssse3";
+        default:                 return "scalar";
+    }
+}
+
+// индексы вне 0..N-1 вылетели бы за таблицы, проверяем заранее
+void SmallRingArithmetic::checkIndices(const uint8_t* values, size_t count) const {
+    uint8_t max_value = 0;
+    for (size_t i = 0; i < count; ++i) {
+        max_value = std::max(max_value, values[i]);
+    }
+    if (count > 0 && max_value >= size_) {
+        throw std::runtime_error("Batch operand index out of ring range: " +
+                                 std::to_string(max_value));
+    }
+}
+
+void SmallRingArithmetic::addMany(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count) const {
+    checkIndices(a, count);
+    checkIndices(b, count);
+
+    size_t done = 0;
+#ifdef RING_BATCH_X86
+    if (size_ <= MAX_ADD_SIZE) {
+        switch (activeKernel()) {
+            case BatchKernel::Avx2:  done = addAvx2(a, b, out, count, size_); break;
+            case BatchKernel::Ssse3: done = addSsse3(a, b, out, count, size_); break;
+            default: break;
+        }
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        out[i] = addIndex(a[i], b[i]);
+    }
+}
+
+void SmallRingArithmetic::subMany(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count) const {
+    checkIndices(a, count);
+    checkIndices(b, count);
+
+    size_t done = 0;
+#ifdef RING_BATCH_X86
+    if (size_ <= MAX_ADD_SIZE) {
+        switch (activeKernel()) {
+            case BatchKernel::Avx2:  done = subAvx2(a, b, out, count, size_); break;
+            case BatchKernel::Ssse3: done = subSsse3(a, b, out, count, size_); break;
+            default: break;
+        }
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        out[i] = subtractIndex(a[i], b[i]);
+    }
+}
+
+void SmallRingArithmetic::mulMany(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t count) const {
+    checkIndices(a, count);
+    checkIndices(b, count);
+
+    size_t done = 0;
+#ifdef RING_BATCH_X86
+    if (size_ <= MAX_SHUFFLE_SIZE) {
+        switch (activeKernel()) {
+            case BatchKernel::Avx2:  done = mulAvx2(a, b, out, count, mul_, size_); break;
+            case BatchKernel::Ssse3: done = mulSsse3(a, b, out, count, mul_, size_); break;
+            default: break;
+        }
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        out[i] = multiplyIndex(a[i], b[i]);
+    }
+}
+
+void SmallRingArithmetic::invMany(const uint8_t* a, uint8_t* out, size_t count) const {
+    checkIndices(a, count);
+    const uint8_t* inv = rules_.getInvTable().data();
+
+    // необратимые элементы помечены в таблице как NO_INVERSE; ищем их в a
+    // до записи: при out == a исходные индексы иначе уже затёрты.
+    // в поле необратим только ноль - поиск байта без таблицы
+    const uint8_t* bad = std::count(inv, inv + size_, FiniteRingRules::NO_INVERSE) == 1
+        ? std::find(a, a + count, uint8_t(0))
+        : std::find_if(a, a + count, [inv](uint8_t v) { return inv[v] == FiniteRingRules::NO_INVERSE; });
+    if (bad != a + count) {
+        if (*bad == 0) {
+            throw std::runtime_error("Zero has no multiplicative inverse");
+        }
+        throw std::runtime_error("No multiplicative inverse for element: " +
+                                 std::string(1, rules_.getValueChar(*bad)));
+    }
+
+    size_t done = 0;
+#ifdef RING_BATCH_X86
+    if (size_ <= MAX_SHUFFLE_SIZE) {
+        switch (activeKernel()) {
+            case BatchKernel::Avx2:  done = lookupAvx2(a, out, count, inv, size_); break;
+            case BatchKernel::Ssse3: done = lookupSsse3(a, out, count, inv, size_); break;
+            default: break;
+        }
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        out[i] = inv[a[i]];
+    }
+}
@@ -0,0 +1,252 @@
+// core/src/TableGenerator.cc
+#include "TableGenerator.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using std::string;
+using std::vector;
+
+namespace {
+
+// * --- БУФЕРИЗОВАННЫЙ ПИСАТЕЛЬ ---
+// ячейки собираются в строку и уходят в поток блоками по 64 КБ
+class BufferedWriter {
+public:
+    explicit BufferedWriter(std::ostream& out) : out_(out) { buffer_.reserve(kBlock); }
+    ~BufferedWriter() { flush(); }
+
+    BufferedWriter& operator<<(char c) {
+        buffer_.push_back(c);
+        return maybeFlush();
+    }
+    BufferedWriter& operator<<(const char* s) {
+        buffer_.append(s);
+        return maybeFlush();
+    }
+    BufferedWriter& operator<<(const string& s) {
+        buffer_.append(s);
+        return maybeFlush();
+    }
+
+    void flush() {
+        out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+
+private:
+    static constexpr size_t kBlock = 1 << 16;
+    std::ostream& out_;
+    string buffer_;
+
+    BufferedWriter& maybeFlush() {
+        if (buffer_.size() >= kBlock) {
+            flush();
+        }
+        return *this;
+    }
+};
+
+// * символ ячейки с экранированием под формат
+string cell(char c, TableFormat format) {
+    switch (format) {
+        case TableFormat::Csv:
+            if (c == ',' || c == '"' || c == '\n') {
+                return c == '"' ? "\"\"\"\"" : string("\"") + c + "\"";
+            }
+            break;
+        case TableFormat::Markdown:
+            if (c == '|' || c == '\\' || c == '*' || c == '_') {
+                return string("\\") + c;
+            }
+            break;
+        case TableFormat::Latex:
+            switch (c) {
+                case '#': case '$': case '%': case '&': case '_': case '{': case '}':
+                    return string("\\") + c;
+                case '~': return "\\textasciitilde{}";
+                case '^': return "\\textasciicircum{}";
+                case '\\': return "\\textbackslash{}";
+                default: break;
+            }
+            break;
+    }
+    return string(1, c);
+}
+
+// знак операции в левом верхнем углу
+const char* corner(TableKind kind, TableFormat format) {
+    const bool latex = format == TableFormat::Latex;
+    switch (kind) {
+        case TableKind::Add: return latex ? "$+$" : "+";
+        case TableKind::Multiply: return latex ? "$\\times$" : "*";
+        case TableKind::AddCarry: return latex ? "$c_{+}$" : "c+";
+        case TableKind::MultiplyCarry: return latex ? "$c_{\\times}$" : "c*";
+    }
+    return "";
+}
+
+void writeTable(BufferedWriter& out, const FiniteRingRules& rules, const vector<uint8_t>& table,
+                TableKind kind, TableFormat format) {
+    const int n = rules.getSize();
+    vector<string> symbols(n);
+    for (int i = 0; i < n; ++i) {
+        symbols[i] = cell(rules.getValueChar(i), format);
+    }
+
+    switch (format) {
+        case TableFormat::Csv:
+            out << corner(kind, format);
+            for (int b = 0; b < n; ++b) {
+                out << ',' << symbols[b];
+            }
+            out << '\n';
+            for (int a = 0; a < n; ++a) {
+                out << symbols[a];
+                for (int b = 0; b < n; ++b) {
+                    out << ',' << symbols[table[a * n + b]];
+                }
+                out << '\n';
+            }
+            break;
+
+        case TableFormat::Markdown:
+            out << "| " << corner(kind, format) << " |";
+            for (int b = 0; b < n; ++b) {
+                out << ' ' << symbols[b] << " |";
+            }
+            out << "\n|---|";
+            for (int b = 0; b < n; ++b) {
+                out << "---|";
+            }
+            out << '\n';
+            for (int a = 0; a < n; ++a) {
+                out << "| **" << symbols[a] << "** |";
+                for (int b = 0; b < n; ++b) {
+                    out << ' ' << symbols[table[a * n + b]] << " |";
+                }
+                out << '\n';
+            }
+            break;
+
+        case TableFormat::Latex:
+            out << "\\begin{tabular}{c|" << string(n, 'c') << "}\n" << corner(kind, format);
+            for (int b = 0; b < n; ++b) {
+                out << " & " << symbols[b];
+            }
+            out << " \\\\\n\\hline\n";
+            for (int a = 0; a < n; ++a) {
+                out << symbols[a];
+                for (int b = 0; b < n; ++b) {
+                    out << " & " << symbols[table[a * n + b]];
+                }
+                out << " \\\\\n";
+            }
+            out << "\\end{tabular}\n";
+            break;
+    }
+}
+
+}  // namespace
+
+// * --- ГЕНЕРАЦИЯ: все четыре таблицы за один проход ---
+TableGenerator::TableGenerator(const FiniteRingRules& rules) : rules_(rules) {
+    const int n = rules_.getSize();
+    const size_t cells = static_cast<size_t>(n) * n;
+    add_.resize(cells);
+    multiply_.resize(cells);
+    add_carry_.resize(cells);
+    multiply_carry_.resize(cells);
+
+    // перенос сложения - из таблицы позиционного сложения (вход без переноса)
+    const vector<uint8_t>& add_table = rules_.getAddTable();
+    const vector<uint8_t>& mul_table = rules_.getMulTable();
+    const vector<uint16_t>& carry_table = rules_.getCarryTable();
+    for (int a = 0; a < n; ++a) {
+        for (int b = 0; b < n; ++b) {
+            const size_t i = static_cast<size_t>(a) * n + b;
+            add_[i] = add_table[i];
+            multiply_[i] = mul_table[i];
+            add_carry_[i] = static_cast<uint8_t>(carry_table[i] >> 8);
+            multiply_carry_[i] = static_cast<uint8_t>(a * b / n);
+        }
+    }
+}
+
+const vector<uint8_t>& TableGenerator::table(TableKind kind) const {
+    switch (kind) {
+        case TableKind::Add: return add_;
+        case TableKind::Multiply: return multiply_;
+        case TableKind::AddCarry: return add_carry_;
+        case TableKind::MultiplyCarry: return multiply_carry_;
+    }
+    throw std::runtime_error("Unknown table kind");
+}
+
+const vector<TableKind>& TableGenerator::allTables() {
+    static const vector<TableKind> kinds = {
+        TableKind::Add, TableKind::Multiply, TableKind::AddCarry, TableKind::MultiplyCarry
+    };
+    return kinds;
+}
+
+string TableGenerator::tableTitle(TableKind kind) {
+    switch (kind) {
+        case TableKind::Add: return "Таблица сложения";
+        case TableKind::Multiply: return "Таблица умножения";
+        case TableKind::AddCarry: return "Таблица переносов сложения";
+        case TableKind::MultiplyCarry: return "Таблица переносов умножения";
+    }
+    throw std::runtime_error("Unknown table kind");
+}
+
+TableFormat TableGenerator::parseFormat(const string& name) {
+    if (name == "csv") return TableFormat::Csv;
+    if (name == "md" || name == "markdown") return TableFormat::Markdown;
+    if (name == "tex" || name == "latex") return TableFormat::Latex;
+    throw std::runtime_error("Unknown table format: '" + name + "'");
+}
+
+// * --- ВЫВОД ---
+void TableGenerator::write(std::ostream& out, TableKind kind, TableFormat format) const {
+    BufferedWriter writer(out);
+    writeTable(writer, rules_, table(kind), kind, format);
+}
+
+void TableGenerator::writeAll(std::ostream& out, TableFormat format) const {
+    BufferedWriter writer(out);
+    bool first = true;
+    for (TableKind kind : allTables()) {
+        if (!first) {
+            writer << '\n';
+        }
+        first = false;
+        // заголовок: строка CSV из одной ячейки, подзаголовок Markdown, комментарий LaTeX
+        switch (format) {
+            case TableFormat::Csv: writer << tableTitle(kind) << '\n'; break;
+            case TableFormat::Markdown: writer << "### " << tableTitle(kind) << "\n\n"; break;
+            case TableFormat::Latex: writer << "% " << tableTitle(kind) << '\n'; break;
+        }
+        writeTable(writer, rules_, table(kind), kind, format);
+    }
+}
+
+string TableGenerator::render(TableKind kind, TableFormat format) const {
+    std::ostringstream out;
+    write(out, kind, format);
+    return out.str();
+}
+
+string TableGenerator::renderAll(TableFormat format) const {
+    std::ostringstream out;
+    writeAll(out, format);
+    return out.str();
+}
+
+void TableGenerator::writeFile(const string& path, TableFormat format) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open output file: " + path);
+    }
+    writeAll(file, format);
+}
@@ -0,0 +1,166 @@
+// core/src/WorkStealingPool.cc
+#include "WorkStealingPool.h"
+#include <algorithm>
+
+WorkStealingPool::WorkStealingPool(unsigned threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        workers_.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+bool WorkStealingPool::parallelFor(uint64_t count, uint64_t grain, const RangeBody& body,
+                                   const std::function<void()>& on_wait,
+                                   std::chrono::milliseconds interval) {
+    if (count == 0) {
+        return true;
+    }
+    grain = std::max<uint64_t>(grain, 1);
+
+    std::lock_guard<std::mutex> call_lock(call_mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // * состояние вызова сбрасывается до раздачи блоков
+    stop_.store(false);
+    error_ = nullptr;
+
+    // * по блоку на поток; границы блоков кратны grain
+    ++generation_;
+    const uint64_t chunks = (count - 1) / grain + 1;
+    const uint64_t threads = queues_.size();
+    auto blockStart = [&](uint64_t i) {
+        return std::min(count, (i * (chunks / threads) + std::min(i, chunks % threads)) * grain);
+    };
+    for (uint64_t i = 0; i < threads; ++i) {
+        Queue& queue = *queues_[i];
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        queue.generation = generation_;
+        queue.begin = blockStart(i);
+        queue.end = blockStart(i + 1);
+        queue.grain = grain;
+        queue.body = &body;
+    }
+    pending_ = count;
+    wake_.notify_all();
+
+    while (pending_ != 0) {
+        if (on_wait) {
+            done_.wait_for(lock, interval, [this] { return pending_ == 0; });
+            if (pending_ != 0) {
+                lock.unlock();
+                on_wait();
+                lock.lock();
+            }
+        } else {
+            done_.wait(lock, [this] { return pending_ == 0; });
+        }
+    }
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+    return !stop_.load();
+}
+
+void WorkStealingPool::workerLoop(unsigned index) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return shutdown_ || generation_ != seen; });
+            if (shutdown_) {
+                return;
+            }
+            seen = generation_;
+        }
+
+        Range range;
+        while (takeRange(index, seen, range)) {
+            // после остановки диапазоны только списываются
+            if (!stop_.load(std::memory_order_relaxed)) {
+                try {
+                    if (!(*range.body)(range.begin, range.end)) {
+                        stop_.store(true);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!error_) {
+                        error_ = std::current_exception();
+                    }
+                    stop_.store(true);
+                }
+            }
+            finishRange(range.end - range.begin);
+        }
+    }
+}
+
+// * свой блок - по grain с начала; у чужого - верхняя половина остатка.
+// * после остановки остаток берётся целиком: его только списывают
+bool WorkStealingPool::takeRange(unsigned index, uint64_t generation, Range& range) {
+    Queue& own = *queues_[index];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.generation == generation && own.begin < own.end) {
+            const uint64_t length = stop_.load() ? own.end - own.begin
+                                                 : std::min(own.grain, own.end - own.begin);
+            range = Range{own.begin, own.begin + length, own.body};
+            own.begin += length;
+            return true;
+        }
+    }
+    for (size_t step = 1; step < queues_.size(); ++step) {
+        Queue& victim = *queues_[(index + step) % queues_.size()];
+        Range stolen;
+        uint64_t grain;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.generation != generation || victim.begin >= victim.end) {
+                continue;
+            }
+            grain = victim.grain;
+            const uint64_t chunks = (victim.end - victim.begin - 1) / grain + 1;
+            if (chunks == 1 || stop_.load()) {
+                range = Range{victim.begin, victim.end, victim.body};
+                victim.begin = victim.end;
+                return true;
+            }
+            const uint64_t middle = victim.begin + (chunks - chunks / 2) * grain;
+            stolen = Range{middle, victim.end, victim.body};
+            victim.end = middle;
+        }
+        // украденное - в свой блок, его в свою очередь могут красть другие
+        std::lock_guard<std::mutex> lock(own.mutex);
+        range = Range{stolen.begin, std::min(stolen.end, stolen.begin + grain), stolen.body};
+        own.generation = generation;
+        own.begin = range.end;
+        own.end = stolen.end;
+        own.grain = grain;
+        own.body = stolen.body;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::finishRange(uint64_t items) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_ -= items;
+    if (pending_ == 0) {
+        done_.notify_all();
+    }
+}
@@ -7,36 +7,19 @@
 
 
 
-// * --- СРАВНЕНИЕ СИМВОЛОВ: a < b? ---
-bool BigRingArithmetic::isLessThan(char a, char b) const {
-    if (a == b) {
-        return false;
-    }
-
-    char cursor = zero_;
-    do {
-        if (cursor == a) {
-            return true;
-        }
-        if (cursor == b) {
-            return false;
-        }
-        cursor = small_.plusOne(cursor);
-    } while (cursor != zero_);
-
-    throw std::runtime_error("Ring traversal failed while comparing digits");
+// * --- СРАВНЕНИЕ ЦИФР: a < b? ---
+// индекс цифры = её позиция в цикле "+1" от нуля, поэтому обход
+// кольца от нуля до первой встреченной цифры равносилен сравнению индексов
+bool BigRingArithmetic::isLessThan(uint8_t a, uint8_t b) const {
+    return a < b;
 }
 
 // * --- СРАВНЕНИЕ ЧИСЕЛ: a >= b? ---
-bool BigRingArithmetic::isGreaterOrEqual(const RingNumber& a, const RingNumber& b) const {
+bool BigRingArithmetic::isGreaterOrEqual(DigitView a, DigitView b) const {
     
-    // нормализуем оба числа
-    RingNumber a_norm = a;
-    RingNumber b_norm = b;
-    a_norm.setNegative(false);
-    b_norm.setNegative(false);
-    a_norm.normalize();
-    b_norm.normalize();
+    // окна без ведущих нулей вместо нормализованных копий
+    const DigitView a_norm = a.trimmed();
+    const DigitView b_norm = b.trimmed();
     
     size_t len_a = a_norm.length();
     size_t len_b = b_norm.length();
@@ -48,8 +31,8 @@ bool BigRingArithmetic::isGreaterOrEqual(const RingNumber& a, const RingNumber&
     
     // 2. сравниваем поразрядно от СТАРШЕГО к младшему
     for (int i = static_cast<int>(len_a) - 1; i >= 0; --i) {
-        char digit_a = a_norm[i];
-        char digit_b = b_norm[i];
+        uint8_t digit_a = a_norm[i];
+        uint8_t digit_b = b_norm[i];
 
         if (digit_a == digit_b) {
             continue;
@@ -58,4 +41,33 @@ bool BigRingArithmetic::isGreaterOrEqual(const RingNumber& a, const RingNumber&
     }
     
     return true; // числа равны
-}
\ No newline at end of file
+}
+
+// * --- ПЕРЕВОД В МАШИННОЕ ЦЕЛОЕ И ОБРАТНО ---
+// индексы цифр позиционны по основанию N, так что значение - схема Горнера
+int64_t BigRingArithmetic::toNative(const RingNumber& num) const {
+    const DigitBuffer& digits = num.getValues();
+    const int64_t base = rules_.getSize();
+
+    int64_t value = 0;
+    for (size_t i = digits.size(); i > 0; --i) {
+        value = value * base + digits[i - 1];
+    }
+    return num.isNegative() ? -value : value;
+}
+
+RingNumber BigRingArithmetic::fromNative(int64_t value) const {
+    const int64_t base = rules_.getSize();
+    bool negative = value < 0;
+    // |value| < 2^63 для всех чисел из быстрого пути
+    uint64_t magnitude = negative ? static_cast<uint64_t>(-value) : static_cast<uint64_t>(value);
+
+    // не больше k + 1 цифр, для коротких чисел буфер остаётся встроенным
+    DigitBuffer digits;
+    do {
+        digits.push_back(static_cast<uint8_t>(magnitude % base));
+        magnitude /= base;
+    } while (magnitude != 0);
+
+    return RingNumber(rules_, std::move(digits), negative);
+}
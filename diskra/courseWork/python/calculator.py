@@ -1,14 +1,13 @@
 # python/calculator.py
 import sys
 import os
-import yaml
 import re
 from typing import Dict, Any, List, Optional
 
 # добавляем путь к C++ модулю
 sys.path.insert(0, 'build')
 try:
-    from finite_ring_module import FiniteRingRules, SmallRingArithmetic, BigRingArithmetic, RingNumber, DivisionResult # type: ignore
+    from finite_ring_module import RingRegistry, SmallRingArithmetic, BigRingArithmetic, RingNumber, DivisionResult, RingExpression # type: ignore
 except ImportError:
     print("--- ОШИБКА: Не удалось импортировать 'с++ модуль'.")
     sys.exit(1)
@@ -24,9 +23,12 @@ class Calculator:
     def __init__(self, variant_name: str) -> None:
         self._print_header(variant_name)
         self.last_result: Any = None 
+        # скомпилированные выражения: повторный ввод не разбирается заново
+        self._compiled: Dict[str, Any] = {}
         
         try:
-            self.rules = FiniteRingRules("config.yaml", variant_name)
+            # правила берутся из реестра: config.yaml разбирается один раз на процесс
+            self.rules = RingRegistry.instance("config.yaml").rules(variant_name)
             self.small_engine = SmallRingArithmetic(self.rules)
             self.engine = BigRingArithmetic(self.rules, self.small_engine)
             
@@ -109,11 +111,25 @@ class Calculator:
         except Exception as e:
             return f"Ошибка вычисления: {e}"
     
+    def evaluate_expression(self, expression: str) -> Any:
+        """Вычисляет произвольное выражение: приоритеты, скобки, унарный минус, / и %."""
+        try:
+            compiled = self._compiled.get(expression)
+            if compiled is None:
+                compiled = RingExpression(self.rules, self.engine, expression)
+                self._compiled[expression] = compiled
+            result_obj = compiled.evaluate()
+            self.last_result = result_obj
+            return result_obj
+        except RuntimeError as e:
+            return f"Ошибка вычисления: {e}"
+
     def _display_help(self):
         print("\n--- СПРАВКА ---")
         print("Формат ввода: <число> <оператор> <число> (Например: cab * -bac)")
         print("Поддерживаемые операторы: +, -, *, /")
         print("Числа могут начинаться с минуса (унарный минус: -bac)")
+        print("Выражения: (bac + c) * -d % bb - приоритеты, скобки, / частное, % остаток")
         print("\nСпециальные команды:")
         print("  /rules - Показать правила кольца (отношение порядка, таблица индексов)")
         print("  /help  - Показать эту справку")
@@ -159,7 +175,15 @@ class Calculator:
                 parsed = self._parse_expression(expression)
                 
                 if not parsed:
-                    print(f"  -> Ошибка формата! Используйте: число оператор число (например, cab * -bac)")
+                    # не "a op b" - разбираем как полное выражение
+                    result_obj = self.evaluate_expression(expression)
+                    if isinstance(result_obj, str):
+                        print(f"  -> {result_obj}")
+                        continue
+                    result_str = result_obj.toString()
+                    if self._exceeds_max_digits(result_str):
+                        print(f"  -> StackOverflow! Результат свыше {self.MAX_DIGITS} разрядов.")
+                    print(f"  -> {expression} = {result_str}")
                     continue
                 
                 op1_full, operator, op2_full = parsed
@@ -200,23 +224,20 @@ def load_variants() -> List[Dict[str, Any]]:
         if not os.path.exists("config.yaml"):
              raise FileNotFoundError("Файл 'config.yaml' не найден.")
              
-        with open("config.yaml", "r", encoding="utf-8") as f:
-            config = yaml.safe_load(f) or {}
-            variants: List[Dict[str, Any]] = []
-            
-            for field_type, field_variants in config.get("variants", {}).items():
-                if isinstance(field_variants, dict):
-                    for variant_name, variant_data in field_variants.items():
-                        if isinstance(variant_data, dict):
-                            size = variant_data.get("size", "?")
-                            symbols = variant_data.get("rule_plus_one", [])
-                            variants.append({
-                                'name': variant_name,
-                                'type': field_type,
-                                'size': size,
-                                'symbols': symbols
-                            })
-            return variants
+        # реестр загружает и проверяет все варианты один раз,
+        # Calculator потом берёт правила из того же кэша
+        registry = RingRegistry.instance("config.yaml")
+        variants: List[Dict[str, Any]] = []
+        
+        for variant_name in registry.getNames():
+            rules = registry.rules(variant_name)
+            variants.append({
+                'name': variant_name,
+                'type': registry.getGroup(variant_name),
+                'size': rules.getSize(),
+                'symbols': rules.getOrderedValues()
+            })
+        return variants
             
     except Exception as e:
         print(f"--- ОШИБКА загрузки вариантов из config.yaml: {e}")
@@ -1,7 +1,10 @@
 import sys
 import os
+import argparse
 from typing import List
 
+import numpy as np
+
 # Проверяем, что скрипт запускается из нужной директории
 if not os.path.exists('config.yaml'):
     print("Ошибка: Файл 'config.yaml' не найден. Запускайте скрипт из корневой директории проекта.")
@@ -11,11 +14,9 @@ sys.path.insert(0, 'build')
 
 try:
     from finite_ring_module import (
-        FiniteRingRules, 
-        SmallRingArithmetic, 
-        BigRingArithmetic, 
-        RingNumber, 
-        DivisionResult
+        RingRegistry,
+        TableGenerator,
+        TableKind,
     )
 except ImportError as e:
     print(f"Ошибка импорта модуля: {e}")
@@ -25,50 +26,44 @@ except ImportError as e:
 
 # --- Основная логика генерации таблиц ---
 
-VARIANT_NAME = "D9" # Выбранный вариант D9
-rules = FiniteRingRules("config.yaml", VARIANT_NAME)
-small = SmallRingArithmetic(rules)
+parser = argparse.ArgumentParser(description="Таблицы операций и переносов")
+parser.add_argument("--variant", default="D9",
+                    help="имя варианта или 'all' (по умолчанию D9)")
+parser.add_argument("--format", choices=["csv", "md", "latex"],
+                    help="записать отчёт в файл вместо вывода в консоль")
+parser.add_argument("--out", default="tables", help="каталог для отчётов")
+args = parser.parse_args()
+
+registry = RingRegistry.instance("config.yaml")
+
+# Отчёты в файлы: все таблицы варианта одним вызовом C++
+if args.format:
+    names = registry.getNames() if args.variant == "all" else [args.variant]
+    extension = {"csv": "csv", "md": "md", "latex": "tex"}[args.format]
+    os.makedirs(args.out, exist_ok=True)
+    for name in names:
+        path = os.path.join(args.out, f"{name}.{extension}")
+        TableGenerator(registry.rules(name)).writeFile(path, TableGenerator.parseFormat(args.format))
+        print(f"{name}: {path}")
+    sys.exit(0)
+
+rules = registry.rules(args.variant)
+generator = TableGenerator(rules)
 
 symbols = [rules.getValueChar(i) for i in range(rules.getSize())]
 SIZE = rules.getSize()
 
-# Создаем карту соответствия: символ -> индекс (0..N-1)
-symbol_map = {sym: i for i, sym in enumerate(symbols)}
-
 # Увеличенная ширина ячейки для идеального зазора
 CELL_WIDTH = 3
 
-def get_add_carry(a: str, b: str) -> str:
-    """
-    Вычисляет перенос при сложении.
-    Carry = (Index(a) + Index(b)) // Size
-    Возвращает символ кольца, соответствующий этому значению.
-    """
-    val_a = symbol_map[a]
-    val_b = symbol_map[b]
-    carry_idx = (val_a + val_b) // SIZE
-    # В случае сложения перенос обычно 0 или 1, но код универсален
-    return symbols[carry_idx]
-
-def get_mult_carry(a: str, b: str) -> str:
-    """
-    Вычисляет перенос при умножении.
-    Carry = (Index(a) * Index(b)) // Size
-    Возвращает символ кольца, соответствующий этому значению.
-    """
-    val_a = symbol_map[a]
-    val_b = symbol_map[b]
-    carry_idx = (val_a * val_b) // SIZE
-    return symbols[carry_idx]
-
-def print_table(operation_name: str, symbols: List[str], operation_func):
-    """Генерирует и выводит таблицу для заданной операции, обеспечивая идеальное выравнивание."""
+def print_table(operation_name: str, symbols: List[str], table: np.ndarray):
+    """Выводит таблицу индексов как символы кольца, обеспечивая идеальное выравнивание."""
     
     # 1. Заголовочная строка
     header_start = " " * CELL_WIDTH + "|"
     header_symbols = "".join([sym.ljust(CELL_WIDTH) for sym in symbols])
     
-    print(f"\n{' ' * 8} Таблица переносов {operation_name}:\n")
+    print(f"\n{' ' * 8} {operation_name}:\n")
     print(f"{header_start} {header_symbols}")
     
     # 2. Разделительная линия
@@ -76,28 +71,25 @@ def print_table(operation_name: str, symbols: List[str], operation_func):
     separator = "-" * CELL_WIDTH + "+" + "-" * (data_line_length + 1)
     print(separator)
 
-    # 3. Строки данных
-    for a in symbols:
-        row_start = a.ljust(CELL_WIDTH) + "|"
-        data_cells = []
-        for b in symbols:
-            result = operation_func(a, b)
-            # result[-1] берет последний символ, работает и для char и для string
-            result_char = result[-1] 
-            data_cells.append(result_char.ljust(CELL_WIDTH))
-        
-        print(f"{row_start} {''.join(data_cells)}")
+    # 3. Строки данных: индексы -> символы одной выборкой
+    cells = np.array([sym.ljust(CELL_WIDTH) for sym in symbols])[table]
+    for a, row in zip(symbols, cells):
+        print(f"{a.ljust(CELL_WIDTH)}| {''.join(row)}")
 
 # --- Вывод ---
 
 print("==========================================")
-print(f"Генерация таблиц ПЕРЕНОСОВ для кольца Z{SIZE} (D9)")
+print(f"Генерация таблиц операций и переносов для кольца Z{SIZE} ({args.variant})")
 print("==========================================")
 
+# Все четыре таблицы посчитаны в C++ за один проход
+print_table("Таблица сложения", symbols, generator.table(TableKind.Add))
+print_table("Таблица умножения", symbols, generator.table(TableKind.Multiply))
+
 # Таблица переносов сложения
-print_table("сложения", symbols, get_add_carry)
+print_table("Таблица переносов сложения", symbols, generator.table(TableKind.AddCarry))
 
 # Таблица переносов умножения
-print_table("умножения", symbols, get_mult_carry)
+print_table("Таблица переносов умножения", symbols, generator.table(TableKind.MultiplyCarry))
 
 print("\n==========================================")
\ No newline at end of file
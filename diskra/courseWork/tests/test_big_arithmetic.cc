@@ -10,6 +10,7 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <random>
 
 class BigArithmeticTest : public ::testing::Test {
 protected:
@@ -44,6 +45,18 @@ protected:
     RingNumber makeNumber(const std::string& s) {
         return RingNumber(*rules_, s);
     }
+
+    // * случайное число заданной длины (детерминированный генератор)
+    RingNumber randomNumber(std::mt19937& gen, size_t length) {
+        std::uniform_int_distribution<int> digit(0, rules_->getSize() - 1);
+        std::string s;
+        for (size_t i = 0; i < length; ++i) {
+            s.push_back(rules_->getValueChar(digit(gen)));
+        }
+        RingNumber num = makeNumber(s);
+        num.setNegative(gen() % 2 == 0);
+        return num;
+    }
 };
 
 // * --- БАЗОВЫЕ ТЕСТЫ ОПЕРАЦИЙ ---
@@ -413,6 +426,240 @@ TEST_F(BigArithmeticTest, Special_MultiplicationExamples) {
     std::cout << "   Specific multiplication examples verified" << std::endl;
 }
 
+// * --- ДЛИННОЕ УМНОЖЕНИЕ (Карацуба выше порога)
+TEST_F(BigArithmeticTest, Multiplication_LongMatchesSchoolbook) {
+    std::mt19937 gen(11);
+    for (size_t len_b : {33, 64, 257}) {
+        RingNumber a = randomNumber(gen, 700);
+        RingNumber b = randomNumber(gen, len_b);
+
+        // эталон: сумма a * b_i со сдвигом на i разрядов (умножение на цифру)
+        RingNumber expected(*rules_);
+        for (size_t i = 0; i < b.length(); ++i) {
+            std::vector<uint8_t> shifted(i, 0);
+            shifted.push_back(b.getDigitValue(i));
+            RingNumber term = big_->multiply(a.withoutSign(), RingNumber(*rules_, shifted));
+            expected = big_->add(expected, term);
+        }
+        expected.setNegative(a.isNegative() != b.isNegative());
+
+        EXPECT_EQ(big_->multiply(a, b), expected) << "len_b=" << len_b;
+        EXPECT_EQ(big_->multiply(b, a), expected) << "len_b=" << len_b;
+    }
+    std::cout << "   Long multiplication matches schoolbook" << std::endl;
+}
+
+// * --- ДЛИННОЕ ДЕЛЕНИЕ
+TEST_F(BigArithmeticTest, Division_LongInvariant) {
+    std::mt19937 gen(5);
+    for (int iter = 0; iter < 60; ++iter) {
+        RingNumber a = randomNumber(gen, 1 + gen() % 400).withoutSign();
+        RingNumber b = randomNumber(gen, 1 + gen() % 120).withoutSign();
+        if (b.isZero()) {
+            continue;
+        }
+
+        // a = b * q + r, 0 <= r < b
+        DivisionResult res = big_->divide(a, b);
+        EXPECT_EQ(big_->add(big_->multiply(b, res.quotient), res.remainder), a);
+        EXPECT_TRUE(big_->subtract(res.remainder, b).isNegative());
+
+        // (-a) / b: частное на единицу больше по модулю, остаток b - r
+        if (!a.isZero() && !res.remainder.isZero()) {
+            DivisionResult neg = big_->divide(big_->negate(a), b);
+            EXPECT_EQ(neg.remainder, big_->subtract(b, res.remainder));
+            EXPECT_EQ(big_->add(big_->multiply(b, neg.quotient), neg.remainder),
+                      big_->negate(a));
+        }
+    }
+    std::cout << "   Long division: a = b*q + r" << std::endl;
+}
+
+// * --- БЫСТРЫЙ ПУТЬ INT64 (границы по числу цифр)
+TEST_F(BigArithmeticTest, NativePath_Boundaries) {
+    std::mt19937 gen(3);
+    const size_t k = static_cast<size_t>(rules_->getDigitsPerLimb());
+    for (size_t len : {k - 2, k - 1, k, k + 1}) {
+        for (int iter = 0; iter < 20; ++iter) {
+            RingNumber a = randomNumber(gen, len);
+            RingNumber b = randomNumber(gen, 1 + gen() % len);
+            PackedRingNumber pa(a), pb(b);
+
+            // упакованный режим не использует int64, сверяемся с ним
+            EXPECT_EQ(big_->add(a, b), big_->add(pa, pb).toRingNumber()) << "len=" << len;
+            EXPECT_EQ(big_->subtract(a, b), big_->subtract(pa, pb).toRingNumber()) << "len=" << len;
+
+            if (!b.isZero()) {
+                DivisionResult res = big_->divide(a.withoutSign(), b.withoutSign());
+                EXPECT_EQ(big_->add(big_->multiply(res.quotient, b.withoutSign()), res.remainder),
+                          a.withoutSign()) << "len=" << len;
+            }
+        }
+    }
+    std::cout << "   Native int64 path agrees at digit-count boundaries" << std::endl;
+}
+
+// * --- УПАКОВАННЫЙ РЕЖИМ
+TEST_F(BigArithmeticTest, Packed_RoundTrip) {
+    std::mt19937 gen(42);
+    for (size_t len : {1, 7, 20, 21, 22, 500, 3001}) {
+        RingNumber num = randomNumber(gen, len);
+        PackedRingNumber packed(num);
+        EXPECT_EQ(packed.toRingNumber(), num) << "Pack/unpack mismatch, len=" << len;
+    }
+    std::cout << "   Packed round trip" << std::endl;
+}
+
+TEST_F(BigArithmeticTest, Packed_MatchesDigitArithmetic) {
+    std::mt19937 gen(7);
+    for (int iter = 0; iter < 40; ++iter) {
+        RingNumber a = randomNumber(gen, 1 + gen() % 3000);
+        RingNumber b = randomNumber(gen, 1 + gen() % 3000);
+        PackedRingNumber pa(a), pb(b);
+
+        EXPECT_EQ(big_->add(pa, pb).toRingNumber(), big_->add(a, b));
+        EXPECT_EQ(big_->subtract(pa, pb).toRingNumber(), big_->subtract(a, b));
+
+        // знак сравнения согласован с разностью
+        RingNumber diff = big_->subtract(a, b);
+        int expected = diff.isZero() ? 0 : (diff.isNegative() ? -1 : 1);
+        EXPECT_EQ(big_->compare(pa, pb), expected);
+    }
+    std::cout << "   Packed add/subtract/compare match digit arithmetic" << std::endl;
+}
+
+// * --- СТЕПЕНЬ ---
+// показатель как число кольца (цифры по основанию N)
+static RingNumber exponentNumber(const FiniteRingRules& rules, uint64_t e) {
+    std::vector<uint8_t> digits;
+    do {
+        digits.push_back(static_cast<uint8_t>(e % rules.getSize()));
+        e /= rules.getSize();
+    } while (e != 0);
+    return RingNumber(rules, digits);
+}
+
+TEST_F(BigArithmeticTest, Pow_MatchesRepeatedMultiply) {
+    std::mt19937 gen(17);
+    for (int iter = 0; iter < 10; ++iter) {
+        RingNumber base = randomNumber(gen, 1 + gen() % 6);
+        RingNumber expected = makeNumber(std::string(1, one_));
+        for (uint64_t e = 0; e <= 40; ++e) {
+            ASSERT_EQ(big_->pow(base, e), expected) << base.toString() << " ^ " << e;
+            EXPECT_EQ(big_->pow(base, exponentNumber(*rules_, e)), expected);
+            expected = big_->multiply(expected, base);
+        }
+    }
+
+    EXPECT_THROW(big_->pow(makeNumber("c"), makeNumber("-b")), std::runtime_error);
+    std::cout << "   pow matches repeated multiplication" << std::endl;
+}
+
+TEST_F(BigArithmeticTest, Pow_FixedKeepsLowDigits) {
+    std::mt19937 gen(18);
+    for (int iter = 0; iter < 20; ++iter) {
+        RingNumber base = randomNumber(gen, 1 + gen() % 12);
+        uint64_t e = gen() % 300;
+        RingNumber full = big_->pow(base, e);
+        RingNumber fixed = big_->powFixed(base, e);
+
+        // младшие MAX_DIGITS разрядов полного результата, знак тот же
+        ASSERT_LE(fixed.length(), static_cast<size_t>(BigRingArithmetic::MAX_DIGITS));
+        std::vector<uint8_t> low(full.getValues().begin(), full.getValues().end());
+        low.resize(std::min(low.size(), static_cast<size_t>(BigRingArithmetic::MAX_DIGITS)));
+        RingNumber expected(*rules_, low, full.isNegative());
+        EXPECT_EQ(fixed, expected) << base.toString() << " ^ " << e;
+        EXPECT_EQ(big_->powFixed(base, exponentNumber(*rules_, e)), fixed);
+    }
+    std::cout << "   powFixed keeps the low digits of pow" << std::endl;
+}
+
+TEST_F(BigArithmeticTest, Pow_LargeExponentsZ11) {
+    FiniteRingRules rules("../config.yaml", "D1");
+    SmallRingArithmetic small(rules);
+    BigRingArithmetic big(rules, small);
+
+    std::mt19937 gen(19);
+    std::uniform_int_distribution<int> digit(1, rules.getSize() - 1);
+    for (int iter = 0; iter < 5; ++iter) {
+        std::vector<uint8_t> digits(1 + gen() % 5);
+        for (auto& d : digits) {
+            d = static_cast<uint8_t>(digit(gen));
+        }
+        RingNumber base(rules, digits, gen() % 2 == 0);
+        uint64_t e1 = 200 + gen() % 300, e2 = 100 + gen() % 200;
+
+        // b^(e1 + e2) = b^e1 * b^e2, обе ветки окон разной ширины
+        RingNumber lhs = big.pow(base, e1 + e2);
+        EXPECT_EQ(lhs, big.multiply(big.pow(base, e1), big.pow(base, e2)));
+        EXPECT_EQ(lhs, big.pow(base, exponentNumber(rules, e1 + e2)));
+        // фиксированная ширина: то же свойство по модулю N^MAX_DIGITS
+        RingNumber product = big.multiply(big.powFixed(base, e1), big.powFixed(base, e2));
+        EXPECT_EQ(big.powFixed(base, e1 + e2), big.powFixed(product, 1));
+    }
+    std::cout << "   pow exponent law holds for large exponents in Z11" << std::endl;
+}
+
+// * --- НОД И ОБРАТНЫЙ ПО МОДУЛЮ ---
+TEST_F(BigArithmeticTest, Gcd_BezoutIdentity) {
+    std::mt19937 gen(23);
+    for (int iter = 0; iter < 60; ++iter) {
+        // общий множитель, чтобы НОД был нетривиальным
+        RingNumber common = randomNumber(gen, 1 + gen() % 30).withoutSign();
+        RingNumber a = big_->multiply(common, randomNumber(gen, 1 + gen() % 200));
+        RingNumber b = big_->multiply(common, randomNumber(gen, 1 + gen() % 200));
+
+        GcdResult r = big_->extendedGcd(a, b);
+        ASSERT_FALSE(r.gcd.isNegative());
+        EXPECT_EQ(r.gcd, big_->gcd(a, b));
+        EXPECT_EQ(big_->add(big_->multiply(a, r.x), big_->multiply(b, r.y)), r.gcd) << r.toString();
+
+        // НОД делит оба числа, а кофакторы взаимно просты
+        if (!r.gcd.isZero()) {
+            EXPECT_TRUE(big_->divide(a, r.gcd).remainder.isZero());
+            EXPECT_TRUE(big_->divide(b, r.gcd).remainder.isZero());
+            RingNumber unit = big_->gcd(big_->divide(a, r.gcd).quotient, big_->divide(b, r.gcd).quotient);
+            EXPECT_TRUE(unit.isZero() || unit == makeNumber(std::string(1, one_)));
+            if (!common.isZero()) {
+                EXPECT_TRUE(big_->divide(r.gcd, common).remainder.isZero());
+            }
+        }
+    }
+
+    RingNumber zero = makeNumber(std::string(1, zero_));
+    RingNumber c = makeNumber("-ce");
+    EXPECT_TRUE(big_->gcd(zero, zero).isZero());
+    EXPECT_EQ(big_->gcd(c, zero), c.withoutSign());
+    GcdResult r = big_->extendedGcd(zero, c);
+    EXPECT_EQ(big_->multiply(c, r.y), r.gcd);
+    std::cout << "   extendedGcd satisfies Bezout identity" << std::endl;
+}
+
+TEST_F(BigArithmeticTest, Gcd_ModInverse) {
+    std::mt19937 gen(29);
+    RingNumber one = makeNumber(std::string(1, one_));
+    int found = 0;
+    for (int iter = 0; iter < 60; ++iter) {
+        RingNumber a = randomNumber(gen, 1 + gen() % 150);
+        RingNumber m = randomNumber(gen, 1 + gen() % 120);
+        if (m.isZero()) {
+            EXPECT_THROW(big_->modInverse(a, m), std::runtime_error);
+            continue;
+        }
+        if (big_->gcd(a, m) != one) {
+            EXPECT_THROW(big_->modInverse(a, m), std::runtime_error);
+            continue;
+        }
+        RingNumber inv = big_->modInverse(a, m);
+        EXPECT_FALSE(inv.isNegative());
+        EXPECT_EQ(big_->divide(big_->multiply(a, inv), m.withoutSign()).remainder,
+                  big_->divide(one, m.withoutSign()).remainder);
+        ++found;
+    }
+    EXPECT_GT(found, 0);
+    std::cout << "   modInverse: a * inv = 1 (mod m)" << std::endl;
+}
+
 // int main(int argc, char** argv) {
 //     ::testing::InitGoogleTest(&argc, argv);
     
@@ -0,0 +1,129 @@
+// tests/test_expression.cc
+// Тесты компилятора выражений над числами кольца
+
+#include "gtest/gtest.h"
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "BigRingArithmetic.h"
+#include "RingExpression.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <iostream>
+#include <random>
+
+class RingExpressionTest : public ::testing::Test {
+protected:
+    std::unique_ptr<FiniteRingRules> rules_;
+    std::unique_ptr<SmallRingArithmetic> small_;
+    std::unique_ptr<BigRingArithmetic> big_;
+
+    void SetUp() override {
+        rules_ = std::make_unique<FiniteRingRules>("../config.yaml", "variant_1");
+        small_ = std::make_unique<SmallRingArithmetic>(*rules_);
+        big_ = std::make_unique<BigRingArithmetic>(*rules_, *small_);
+
+        std::cout << "\n--- Testing RingExpression (variant_1) ---" << std::endl;
+    }
+
+    RingNumber makeNumber(const std::string& s) {
+        return RingNumber(*rules_, s);
+    }
+
+    RingNumber eval(const std::string& source) {
+        return RingExpression(*rules_, *big_, source).evaluate({});
+    }
+};
+
+// * --- ТЕСТ 1: приоритеты, скобки, унарный минус
+TEST_F(RingExpressionTest, Precedence_AndParentheses) {
+    RingNumber b = makeNumber("bc"), c = makeNumber("ce"), d = makeNumber("gd");
+
+    EXPECT_EQ(eval("bc + ce * gd"), big_->add(b, big_->multiply(c, d)));
+    EXPECT_EQ(eval("(bc + ce) * gd"), big_->multiply(big_->add(b, c), d));
+    EXPECT_EQ(eval("bc - ce - gd"), big_->subtract(big_->subtract(b, c), d));
+    EXPECT_EQ(eval("-bc * ce"), big_->multiply(big_->negate(b), c));
+    EXPECT_EQ(eval("bc - -ce"), big_->add(b, c));
+    EXPECT_EQ(eval("--bc"), b);
+    std::cout << "   Precedence, parentheses and unary minus" << std::endl;
+}
+
+// * --- ТЕСТ 2: частное и остаток
+TEST_F(RingExpressionTest, DivisionAndRemainder) {
+    RingNumber a = makeNumber("-gbcd"), b = makeNumber("ce");
+    DivisionResult expected = big_->divide(a, b);
+
+    EXPECT_EQ(eval("-gbcd / ce"), expected.quotient);
+    EXPECT_EQ(eval("-gbcd % ce"), expected.remainder);
+    EXPECT_EQ(eval("-gbcd / ce * ce + -gbcd % ce"), a);
+    std::cout << "   Division yields quotient, % yields remainder" << std::endl;
+}
+
+// * --- ТЕСТ 3: константы сворачиваются при компиляции
+TEST_F(RingExpressionTest, ConstantFolding) {
+    RingExpression folded(*rules_, *big_, "(bc + ce) * -gd");
+    EXPECT_EQ(folded.codeSize(), 1);
+
+    RingExpression mixed(*rules_, *big_, "x * (bc + ce)", {"x"});
+    EXPECT_EQ(mixed.codeSize(), 3);
+    EXPECT_EQ(mixed.disassemble(), "LOAD x\nPUSH " + big_->add(makeNumber("bc"), makeNumber("ce")).toString() + "\nMUL\n");
+
+    // деление на ноль не сворачивается и бросает при вычислении
+    RingExpression by_zero(*rules_, *big_, "bc / a");
+    EXPECT_THROW(by_zero.evaluate({}), std::runtime_error);
+    std::cout << "   Constant subexpressions folded at compile time" << std::endl;
+}
+
+// * --- ТЕСТ 4: пакетное вычисление совпадает с поштучным
+TEST_F(RingExpressionTest, Batch_MatchesDirectArithmetic) {
+    RingExpression expr(*rules_, *big_, "(x + y) * (x - y) % y + -x", {"x", "y"});
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> digit(1, rules_->getSize() - 1);
+    std::vector<std::vector<RingNumber>> columns(2);
+    for (int i = 0; i < 500; ++i) {
+        for (auto& column : columns) {
+            std::string s;
+            for (int k = 0; k < 1 + i % 12; ++k) {
+                s.push_back(rules_->getValueChar(digit(gen)));
+            }
+            RingNumber num = makeNumber(s);
+            num.setNegative(gen() % 2 == 0);
+            column.push_back(num);
+        }
+    }
+
+    std::vector<RingNumber> results = expr.evaluateBatch(columns);
+    ASSERT_EQ(results.size(), columns[0].size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        const RingNumber& x = columns[0][i];
+        const RingNumber& y = columns[1][i];
+        RingNumber product = big_->multiply(big_->add(x, y), big_->subtract(x, y));
+        RingNumber expected = big_->add(big_->divide(product, y).remainder, big_->negate(x));
+        ASSERT_EQ(results[i], expected) << "row " << i;
+        EXPECT_EQ(expr.evaluate({x, y}), expected);
+    }
+    std::cout << "   Batch evaluation matches direct arithmetic" << std::endl;
+}
+
+// * --- ТЕСТ 5: ошибки разбора и привязок
+TEST_F(RingExpressionTest, Errors) {
+    EXPECT_THROW(RingExpression(*rules_, *big_, "bc +"), std::runtime_error);
+    EXPECT_THROW(RingExpression(*rules_, *big_, "(bc"), std::runtime_error);
+    EXPECT_THROW(RingExpression(*rules_, *big_, "bc ce"), std::runtime_error);
+    EXPECT_THROW(RingExpression(*rules_, *big_, "bc $ ce"), std::runtime_error);
+    EXPECT_THROW(RingExpression(*rules_, *big_, "zz + b"), std::runtime_error);
+    EXPECT_THROW(RingExpression(*rules_, *big_, "x", {"x", "x"}), std::runtime_error);
+
+    RingExpression expr(*rules_, *big_, "x + y", {"x", "y"});
+    EXPECT_THROW(expr.evaluate({makeNumber("b")}), std::runtime_error);
+    EXPECT_THROW(expr.evaluateBatch({{makeNumber("b")}, {}}), std::runtime_error);
+
+    try {
+        RingExpression(*rules_, *big_, "bc * (ce + zz)");
+        FAIL() << "unknown identifier accepted";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("position 11"), std::string::npos) << e.what();
+    }
+    std::cout << "   Parse and binding errors reported" << std::endl;
+}
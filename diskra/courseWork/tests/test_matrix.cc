@@ -0,0 +1,137 @@
+// tests/test_matrix.cc
+// Линейная алгебра над вариантами: умножение, ранг, определитель, обращение
+
+#include "gtest/gtest.h"
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "RingMatrix.h"
+#include "MatrixArithmetic.h"
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class MatrixTest : public ::testing::TestWithParam<std::string> {
+protected:
+    std::unique_ptr<FiniteRingRules> rules_;
+    std::unique_ptr<SmallRingArithmetic> small_;
+    std::unique_ptr<MatrixArithmetic> matrix_;
+    std::mt19937 gen_{11};
+
+    void SetUp() override {
+        rules_ = std::make_unique<FiniteRingRules>("../config.yaml", GetParam());
+        small_ = std::make_unique<SmallRingArithmetic>(*rules_);
+        matrix_ = std::make_unique<MatrixArithmetic>(*small_, 2);
+    }
+
+    RingMatrix randomMatrix(size_t rows, size_t cols) {
+        std::uniform_int_distribution<int> element(0, rules_->getSize() - 1);
+        std::vector<uint8_t> values(rows * cols);
+        for (uint8_t& v : values) {
+            v = static_cast<uint8_t>(element(gen_));
+        }
+        return RingMatrix(*rules_, rows, cols, std::move(values));
+    }
+
+    // невырожденная матрица: перебор случайных до первой с полным рангом
+    RingMatrix randomInvertible(size_t n) {
+        while (true) {
+            RingMatrix a = randomMatrix(n, n);
+            if (matrix_->determinant(a) != 0) {
+                return a;
+            }
+        }
+    }
+
+    RingMatrix naiveMultiply(const RingMatrix& a, const RingMatrix& b) {
+        RingMatrix result(*rules_, a.rows(), b.cols());
+        for (size_t i = 0; i < a.rows(); ++i) {
+            for (size_t j = 0; j < b.cols(); ++j) {
+                uint8_t sum = 0;
+                for (size_t k = 0; k < a.cols(); ++k) {
+                    sum = small_->addIndex(sum, small_->multiplyIndex(a.at(i, k), b.at(k, j)));
+                }
+                result.set(i, j, sum);
+            }
+        }
+        return result;
+    }
+};
+
+TEST_P(MatrixTest, MultiplyMatchesNaive) {
+    // размеры по обе стороны границ блоков (16 строк, 128 глубины, 512 столбцов)
+    const std::vector<std::vector<size_t>> shapes = {
+        {1, 1, 1}, {3, 5, 7}, {17, 129, 33}, {40, 300, 520}
+    };
+    for (const auto& shape : shapes) {
+        const RingMatrix a = randomMatrix(shape[0], shape[1]);
+        const RingMatrix b = randomMatrix(shape[1], shape[2]);
+        EXPECT_EQ(matrix_->multiply(a, b), naiveMultiply(a, b))
+            << shape[0] << "x" << shape[1] << "x" << shape[2];
+    }
+    const RingMatrix a = randomMatrix(20, 30);
+    EXPECT_EQ(matrix_->transpose(matrix_->transpose(a)), a);
+    EXPECT_EQ(matrix_->subtract(matrix_->add(a, a), a), a);
+    EXPECT_THROW(matrix_->multiply(a, a), std::runtime_error);
+    std::cout << "   Matrix multiply verified" << std::endl;
+}
+
+TEST_P(MatrixTest, InverseAndSolve) {
+    if (!matrix_->isField()) {
+        EXPECT_THROW(matrix_->rank(randomMatrix(4, 4)), std::runtime_error);
+        std::cout << "   Elimination rejected for ring" << std::endl;
+        return;
+    }
+
+    // 200 > порога параллельного шага
+    for (size_t n : {1u, 7u, 64u, 200u}) {
+        const RingMatrix a = randomInvertible(n);
+        const RingMatrix inv = matrix_->inverse(a);
+        EXPECT_EQ(matrix_->multiply(a, inv), RingMatrix::identity(*rules_, n)) << "n = " << n;
+
+        const RingMatrix b = randomMatrix(n, 3);
+        const RingMatrix x = matrix_->solve(a, b);
+        EXPECT_EQ(matrix_->multiply(a, x), b);
+    }
+    EXPECT_THROW(matrix_->inverse(RingMatrix(*rules_, 3, 3)), std::runtime_error);
+    std::cout << "   Matrix inverse verified" << std::endl;
+}
+
+TEST_P(MatrixTest, RankAndDeterminant) {
+    if (!matrix_->isField()) {
+        EXPECT_THROW(matrix_->determinant(randomMatrix(3, 3)), std::runtime_error);
+        std::cout << "   Elimination rejected for ring" << std::endl;
+        return;
+    }
+
+    // det(AB) = det(A) * det(B)
+    for (int i = 0; i < 10; ++i) {
+        const RingMatrix a = randomMatrix(12, 12);
+        const RingMatrix b = randomMatrix(12, 12);
+        EXPECT_EQ(matrix_->determinant(matrix_->multiply(a, b)),
+                  small_->multiplyIndex(matrix_->determinant(a), matrix_->determinant(b)));
+    }
+
+    // произведение n×r на r×n с невырожденными блоками имеет ранг r
+    const size_t n = 150;
+    const size_t r = 37;
+    const RingMatrix left = matrix_->multiply(randomInvertible(n), RingMatrix::identity(*rules_, n).columns(0, r));
+    const RingMatrix right = matrix_->transpose(
+        matrix_->multiply(randomInvertible(n), RingMatrix::identity(*rules_, n).columns(0, r)));
+    const RingMatrix low = matrix_->multiply(left, right);
+    EXPECT_EQ(matrix_->rank(low), r);
+    EXPECT_EQ(matrix_->determinant(low), 0);
+
+    // приведённый вид: ведущие единицы в первых r строках
+    const RingMatrix echelon = matrix_->rowEchelon(low);
+    EXPECT_EQ(matrix_->rank(echelon), r);
+    for (size_t row = r; row < n; ++row) {
+        for (size_t col = 0; col < n; ++col) {
+            ASSERT_EQ(echelon.at(row, col), 0);
+        }
+    }
+    std::cout << "   Matrix rank verified" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Variants, MatrixTest, ::testing::Values("D1", "D9", "variant_1"));
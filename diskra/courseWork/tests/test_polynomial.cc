@@ -0,0 +1,129 @@
+// tests/test_polynomial.cc
+// Многочлены над вариантами: умножение, деление с остатком, НОД
+
+#include "gtest/gtest.h"
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "RingPolynomial.h"
+#include "PolynomialArithmetic.h"
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class PolynomialTest : public ::testing::TestWithParam<std::string> {
+protected:
+    std::unique_ptr<FiniteRingRules> rules_;
+    std::unique_ptr<SmallRingArithmetic> small_;
+    std::unique_ptr<PolynomialArithmetic> poly_;
+    std::mt19937 gen_{7};
+
+    void SetUp() override {
+        rules_ = std::make_unique<FiniteRingRules>("../config.yaml", GetParam());
+        small_ = std::make_unique<SmallRingArithmetic>(*rules_);
+        poly_ = std::make_unique<PolynomialArithmetic>(*small_);
+    }
+
+    RingPolynomial randomPolynomial(size_t length) {
+        std::uniform_int_distribution<int> coefficient(0, rules_->getSize() - 1);
+        std::vector<uint8_t> values(length);
+        for (uint8_t& v : values) {
+            v = static_cast<uint8_t>(coefficient(gen_));
+        }
+        return RingPolynomial(*rules_, std::move(values));
+    }
+
+    // эталон: прямая свёртка по модулю N
+    RingPolynomial naiveMultiply(const RingPolynomial& a, const RingPolynomial& b) {
+        if (a.isZero() || b.isZero()) {
+            return RingPolynomial(*rules_);
+        }
+        const int n = rules_->getSize();
+        std::vector<uint8_t> out(a.getCoefficients().size() + b.getCoefficients().size() - 1, 0);
+        for (size_t i = 0; i < a.getCoefficients().size(); ++i) {
+            for (size_t j = 0; j < b.getCoefficients().size(); ++j) {
+                out[i + j] = static_cast<uint8_t>((out[i + j] + a.coefficient(i) * b.coefficient(j)) % n);
+            }
+        }
+        return RingPolynomial(*rules_, std::move(out));
+    }
+};
+
+TEST_P(PolynomialTest, MultiplyMatchesNaive) {
+    // по обе стороны порога Карацубы
+    for (size_t length : {1u, 5u, 31u, 32u, 70u, 200u}) {
+        for (int i = 0; i < 5; ++i) {
+            const RingPolynomial a = randomPolynomial(length);
+            const RingPolynomial b = randomPolynomial(length + i * 7);
+            EXPECT_EQ(poly_->multiply(a, b), naiveMultiply(a, b)) << "length " << length;
+        }
+    }
+    EXPECT_TRUE(poly_->multiply(randomPolynomial(40), RingPolynomial(*rules_)).isZero());
+    std::cout << "   Polynomial multiply verified" << std::endl;
+}
+
+TEST_P(PolynomialTest, AddSubtractAndStrings) {
+    const RingPolynomial a = randomPolynomial(50);
+    const RingPolynomial b = randomPolynomial(20);
+    EXPECT_EQ(poly_->subtract(poly_->add(a, b), b), a);
+    EXPECT_TRUE(poly_->add(a, poly_->negate(a)).isZero());
+    EXPECT_EQ(poly_->subtract(a, a).degree(), -1);
+
+    // та же запись, что у RingNumber: старшая степень первой
+    const RingPolynomial p(*rules_, a.toString());
+    EXPECT_EQ(p, a);
+    EXPECT_EQ(RingPolynomial::fromRingNumber(a.toRingNumber()), a);
+
+    // p(x) = x^2 + 1 в точке 1 и 0
+    const RingPolynomial q(*rules_, std::vector<uint8_t>{1, 0, 1});
+    EXPECT_EQ(poly_->evaluate(q, 1), 2);
+    EXPECT_EQ(poly_->evaluate(q, 0), 1);
+    std::cout << "   Polynomial add/subtract verified" << std::endl;
+}
+
+TEST_P(PolynomialTest, DivisionInvariant) {
+    for (int i = 0; i < 50; ++i) {
+        const RingPolynomial a = randomPolynomial(40 + i);
+        RingPolynomial b = randomPolynomial(1 + i % 25);
+        if (b.isZero() || rules_->getInvTable()[b.leadingCoefficient()] == FiniteRingRules::NO_INVERSE) {
+            continue;
+        }
+        const PolynomialDivisionResult qr = poly_->divide(a, b);
+        EXPECT_LT(qr.remainder.degree(), b.degree());
+        EXPECT_EQ(poly_->add(poly_->multiply(qr.quotient, b), qr.remainder), a) << qr.toString();
+    }
+    EXPECT_THROW(poly_->divide(randomPolynomial(5), RingPolynomial(*rules_)), std::runtime_error);
+    std::cout << "   Polynomial division verified" << std::endl;
+}
+
+TEST_P(PolynomialTest, GcdOverFields) {
+    if (!poly_->isField()) {
+        EXPECT_THROW(poly_->gcd(randomPolynomial(4), randomPolynomial(3)), std::runtime_error);
+        // 2x + 1 в Z8: старший коэффициент необратим
+        EXPECT_THROW(poly_->divide(randomPolynomial(5), RingPolynomial(*rules_, std::vector<uint8_t>{1, 2})),
+                     std::runtime_error);
+        std::cout << "   Polynomial gcd rejected for ring" << std::endl;
+        return;
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        const RingPolynomial common = poly_->monic(randomPolynomial(3 + i % 5));
+        if (common.isZero()) {
+            continue;
+        }
+        const RingPolynomial a = poly_->multiply(common, randomPolynomial(10 + i));
+        const RingPolynomial b = poly_->multiply(common, randomPolynomial(7 + i));
+        const RingPolynomial g = poly_->gcd(a, b);
+
+        // общий множитель делит НОД, НОД делит оба и нормирован
+        EXPECT_TRUE(poly_->divide(g, common).remainder.isZero());
+        EXPECT_TRUE(poly_->divide(a, g).remainder.isZero());
+        EXPECT_TRUE(poly_->divide(b, g).remainder.isZero());
+        EXPECT_EQ(g.leadingCoefficient(), 1);
+    }
+    EXPECT_TRUE(poly_->gcd(RingPolynomial(*rules_), RingPolynomial(*rules_)).isZero());
+    std::cout << "   Polynomial gcd verified" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Variants, PolynomialTest, ::testing::Values("D1", "D9", "variant_1"));
@@ -0,0 +1,59 @@
+# tests/test_python_batch.py
+# Пакетные операции модуля: numpy-массивы любых целых типов и списки
+# Запуск из каталога сборки (ctest): модуль и ../config.yaml рядом
+
+import sys
+import unittest
+
+try:
+    import numpy as np
+except ImportError:
+    print("numpy не установлен, тест пропущен")
+    sys.exit(77)
+
+from finite_ring_module import FiniteRingRules, SmallRingArithmetic, RingMatrix
+
+
+class BatchDtypeTest(unittest.TestCase):
+    def setUp(self):
+        self.rules = FiniteRingRules("../config.yaml", "D1")
+        self.small = SmallRingArithmetic(self.rules)
+        self.size = self.rules.getSize()
+
+    def test_int64_matches_uint8(self):
+        # np.array([...]) без dtype - int64
+        a = np.arange(self.size)
+        b = (np.arange(self.size) * 3) % self.size
+        self.assertEqual(a.dtype, np.int64)
+        for name in ("add_many", "sub_many", "mul_many"):
+            wide = getattr(self.small, name)(a, b)
+            narrow = getattr(self.small, name)(a.astype(np.uint8), b.astype(np.uint8))
+            self.assertEqual(wide.dtype, np.uint8)
+            np.testing.assert_array_equal(wide, narrow)
+        np.testing.assert_array_equal(self.small.add_many([1, 2], [3, 4]),
+                                      self.small.add_many(np.array([1, 2], np.uint8),
+                                                          np.array([3, 4], np.uint8)))
+        units = np.arange(1, self.size, dtype=np.int32)
+        np.testing.assert_array_equal(self.small.inv_many(units), self.small.inv_many(units.astype(np.uint8)))
+        print("   Batch int64/int32 operands verified")
+
+    def test_matrix_from_int64(self):
+        values = np.arange(6).reshape(2, 3) % self.size
+        mat = RingMatrix(self.rules, values)
+        np.testing.assert_array_equal(mat.toArray(), values)
+        print("   Matrix from int64 array verified")
+
+    def test_rejects_out_of_range(self):
+        # 300 при приведении к uint8 стало бы 44 - должно отвергаться
+        for bad in (np.array([0, 300]), np.array([0, -1]), np.array([0, self.size])):
+            with self.assertRaises(RuntimeError):
+                self.small.add_many(bad, np.zeros(2, np.int64))
+        with self.assertRaises(RuntimeError):
+            self.small.add_many(np.array([0.5, 1.0]), np.zeros(2))
+        with self.assertRaises(RuntimeError):
+            RingMatrix(self.rules, np.array([[0, 300]]))
+        print("   Batch range and dtype validation verified")
+
+
+if __name__ == "__main__":
+    unittest.main()
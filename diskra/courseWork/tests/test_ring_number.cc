@@ -3,6 +3,7 @@
 #include "gtest/gtest.h"
 #include "FiniteRingRules.h"
 #include "RingNumber.h"
+#include "DigitView.h"
 #include <string>
 #include <memory>
 #include <iostream>
@@ -74,4 +75,83 @@ TEST_F(RingNumberTest, Normalization_LeadingZeros) {
     
     EXPECT_EQ(num.toString(), "bc");
         std::cout << "   Normalize string" << std::endl;
-}
\ No newline at end of file
+}
+
+// * --- ТЕСТ 3: Таблица символов
+TEST_F(RingNumberTest, SymbolIndex_AllBytes) {
+    // каждый байт либо символ кольца со своим индексом, либо сентинел
+    int valid = 0;
+    for (int code = 0; code < 256; ++code) {
+        char c = static_cast<char>(code);
+        int idx = rules_->lookupIndex(c);
+        if (idx == FiniteRingRules::INVALID_INDEX) {
+            EXPECT_FALSE(rules_->isValidChar(c));
+            EXPECT_THROW(rules_->getCharValue(c), std::runtime_error);
+            continue;
+        }
+        EXPECT_EQ(rules_->getValueChar(idx), c);
+        valid++;
+    }
+    EXPECT_EQ(valid, rules_->getSize());
+    std::cout << "   Symbol index table covers all bytes" << std::endl;
+}
+
+// * --- ТЕСТ 4: Хранение цифр и перемещение
+TEST_F(RingNumberTest, Storage_InlineAndSpill) {
+    // до 16 цифр - встроенный буфер, длиннее - куча
+    RingNumber short_num(*rules_, std::string(DigitBuffer::INLINE_CAPACITY, 'b'));
+    EXPECT_TRUE(short_num.getValues().isInline());
+
+    RingNumber long_num(*rules_, std::string(3 * DigitBuffer::INLINE_CAPACITY, 'b'));
+    EXPECT_FALSE(long_num.getValues().isInline());
+
+    // перемещение длинного числа забирает буфер без копирования
+    const uint8_t* storage = long_num.getValues().data();
+    RingNumber moved(std::move(long_num));
+    EXPECT_EQ(moved.getValues().data(), storage);
+    EXPECT_EQ(moved.toString(), std::string(3 * DigitBuffer::INLINE_CAPACITY, 'b'));
+
+    // копия короткого числа независима от оригинала
+    RingNumber copy = short_num;
+    copy.flipSign();
+    EXPECT_FALSE(short_num.isNegative());
+    EXPECT_TRUE(copy.isNegative());
+    EXPECT_EQ(copy.withoutSign(), short_num);
+    std::cout << "   Inline storage, spill to heap and moves" << std::endl;
+}
+
+TEST_F(RingNumberTest, Assignment_RebindsRules) {
+    FiniteRingRules other_rules("../config.yaml", "variant_2");
+    RingNumber num(*rules_, "gbc");
+    RingNumber other(other_rules);
+
+    other = num;
+    EXPECT_EQ(&other.getRules(), rules_.get());
+    EXPECT_EQ(other, num);
+    std::cout << "   Assignment takes rules of the source" << std::endl;
+}
+
+// * --- ТЕСТ 5: Окна над цифрами
+TEST_F(RingNumberTest, DigitView_WindowsAndCompare) {
+    RingNumber num(*rules_, "gbcd");   // индексы [d, c, b, g], младший первым
+    const DigitView view = num.getValues();
+
+    // окно не копирует: указывает внутрь буфера числа
+    EXPECT_EQ(view.dropLow(1).data(), num.getValues().data() + 1);
+    EXPECT_EQ(view.dropLow(1).length(), 3);
+    EXPECT_EQ(view.dropLow(10).length(), 0);
+    EXPECT_EQ(view.window(1, 2).length(), 2);
+    EXPECT_EQ(view.digitAt(100), 0);
+
+    // dropLow(k) - целая часть от деления на N^k
+    RingNumber high(*rules_, "gbc");
+    EXPECT_EQ(DigitView::compare(view.dropLow(1), high.getValues()), 0);
+
+    // ведущие нули не влияют на сравнение
+    const uint8_t padded[] = {high.getDigitValue(0), high.getDigitValue(1), high.getDigitValue(2), 0, 0};
+    EXPECT_EQ(DigitView::compare(DigitView(padded, 5), high.getValues()), 0);
+    EXPECT_EQ(DigitView(padded, 5).trimmed().length(), 3);
+    EXPECT_EQ(DigitView::compare(view, high.getValues()), 1);
+    EXPECT_EQ(DigitView::compare(high.getValues(), view), -1);
+    std::cout << "   Digit views window and compare without copies" << std::endl;
+}
@@ -0,0 +1,123 @@
+// tests/test_rns.cc
+// Система остаточных классов: сверка с позиционной арифметикой
+
+#include "gtest/gtest.h"
+#include "RingRegistry.h"
+#include "SmallRingArithmetic.h"
+#include "BigRingArithmetic.h"
+#include "RnsArithmetic.h"
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class RnsArithmeticTest : public ::testing::Test {
+protected:
+    std::unique_ptr<RingRegistry> registry_;
+    std::unique_ptr<SmallRingArithmetic> small_;
+    std::unique_ptr<BigRingArithmetic> big_;
+    std::unique_ptr<RnsArithmetic> rns_;
+    std::mt19937 gen_{2024};
+
+    void SetUp() override {
+        registry_ = std::make_unique<RingRegistry>("../config.yaml");
+        const FiniteRingRules& rules = registry_->rules("variant_1");
+        small_ = std::make_unique<SmallRingArithmetic>(rules);
+        big_ = std::make_unique<BigRingArithmetic>(rules, *small_);
+        // Z8^21 * Z11^18: M ~ 2^125
+        rns_ = std::make_unique<RnsArithmetic>(
+            *registry_, std::vector<std::pair<std::string, size_t>>{{"variant_1", 0}, {"D1", 0}},
+            "variant_1", 2);
+    }
+
+    // случайное число variant_1 до digits цифр со случайным знаком
+    RingNumber randomNumber(size_t digits) {
+        std::uniform_int_distribution<int> digit(0, 7);
+        std::uniform_int_distribution<size_t> length(1, digits);
+        DigitBuffer values(length(gen_));
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<uint8_t>(digit(gen_));
+        }
+        RingNumber num(registry_->rules("variant_1"), std::move(values), gen_() % 2 == 0);
+        num.normalize();
+        return num;
+    }
+};
+
+TEST_F(RnsArithmeticTest, RoundTripMatchesPositional) {
+    EXPECT_EQ(rns_->channelCount(), 2u);
+    EXPECT_EQ(rns_->channelDigits(0), 21u);
+    EXPECT_EQ(rns_->channelDigits(1), 18u);
+
+    // произведение 20-значных чисел (< 2^120) помещается в диапазон
+    for (int i = 0; i < 200; ++i) {
+        const RingNumber a = randomNumber(20);
+        const RingNumber b = randomNumber(20);
+        const RnsNumber ra = rns_->fromRingNumber(a);
+        const RnsNumber rb = rns_->fromRingNumber(b);
+
+        EXPECT_EQ(rns_->toRingNumber(ra), big_->add(a, RingNumber(a.getRules()))) << a.toString();
+        EXPECT_EQ(rns_->toRingNumber(rns_->add(ra, rb)), big_->add(a, b));
+        EXPECT_EQ(rns_->toRingNumber(rns_->subtract(ra, rb)), big_->subtract(a, b));
+        EXPECT_EQ(rns_->toRingNumber(rns_->multiply(ra, rb)), big_->multiply(a, b))
+            << a.toString() << " * " << b.toString();
+        EXPECT_EQ(rns_->toRingNumber(rns_->negate(ra)), big_->negate(a));
+    }
+    std::cout << "   RNS round trip verified" << std::endl;
+}
+
+TEST_F(RnsArithmeticTest, BatchMatchesSingle) {
+    std::vector<RingNumber> a, b;
+    for (int i = 0; i < 100; ++i) {
+        a.push_back(randomNumber(20));
+        b.push_back(randomNumber(20));
+    }
+    const std::vector<RnsNumber> ra = rns_->fromRingNumbers(a);
+    const std::vector<RnsNumber> rb = rns_->fromRingNumbers(b);
+    const std::vector<RingNumber> sums = rns_->toRingNumbers(rns_->addMany(ra, rb));
+    const std::vector<RingNumber> products = rns_->toRingNumbers(rns_->multiplyMany(ra, rb));
+
+    ASSERT_EQ(sums.size(), a.size());
+    ASSERT_EQ(products.size(), a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(sums[i], big_->add(a[i], b[i]));
+        EXPECT_EQ(products[i], big_->multiply(a[i], b[i]));
+    }
+    std::cout << "   RNS batches verified" << std::endl;
+}
+
+TEST_F(RnsArithmeticTest, RangeBoundaries) {
+    // M = 8^21 * 11^18, диапазон [-(M - 1) / 2 .. M / 2]
+    const RingNumber modulus = rns_->getModulus();
+    const RingNumber two(registry_->rules("variant_1"), DigitBuffer{2});
+    const RingNumber one(registry_->rules("variant_1"), DigitBuffer{1});
+    const RingNumber half = big_->divide(modulus, two).quotient;
+    const RingNumber low = big_->negate(big_->subtract(big_->subtract(modulus, half), one));
+
+    EXPECT_EQ(rns_->toRingNumber(rns_->fromRingNumber(half)), half);
+    EXPECT_EQ(rns_->toRingNumber(rns_->fromRingNumber(low)), low);
+    EXPECT_THROW(rns_->fromRingNumber(big_->add(half, one)), std::runtime_error);
+    EXPECT_THROW(rns_->fromRingNumber(big_->subtract(low, one)), std::runtime_error);
+
+    // переполнение заворачивается по модулю M
+    const RnsNumber wrapped = rns_->add(rns_->fromRingNumber(half), rns_->fromRingNumber(one));
+    EXPECT_EQ(rns_->toRingNumber(wrapped), low);
+    std::cout << "   RNS range verified" << std::endl;
+}
+
+TEST_F(RnsArithmeticTest, RejectsBadChannels) {
+    // Z8 и Z8 - общий делитель
+    EXPECT_THROW(RnsArithmetic(*registry_,
+                               std::vector<std::pair<std::string, size_t>>{{"variant_1", 4}, {"variant_2", 4}},
+                               "variant_1"),
+                 std::runtime_error);
+    EXPECT_THROW(RnsArithmetic(*registry_, std::vector<std::pair<std::string, size_t>>{}, "variant_1"),
+                 std::runtime_error);
+
+    // остатки чужой системы
+    RnsArithmetic small_rns(*registry_, std::vector<std::pair<std::string, size_t>>{{"D1", 2}}, "D1");
+    const RnsNumber foreign = small_rns.fromRingNumber(RingNumber(registry_->rules("D1"), DigitBuffer{5}));
+    EXPECT_THROW(rns_->toRingNumber(foreign), std::runtime_error);
+    std::cout << "   RNS channel checks verified" << std::endl;
+}
@@ -3,10 +3,16 @@
 #include "gtest/gtest.h"
 #include "FiniteRingRules.h"
 #include "SmallRingArithmetic.h"
+#include "RingRegistry.h"
+#include "TableGenerator.h"
 #include <string>
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <random>
+#include <fstream>
+#include <cstdio>
+#include <sstream>
 
 class SmallRingArithmeticTest : public ::testing::Test {
 protected:
@@ -285,6 +291,108 @@ TEST_F(SmallRingArithmeticTest, PlusOne_Rule) {
     std::cout << "    Plus-one rule: X+1 gives next element" << std::endl;
 }
 
+TEST_F(SmallRingArithmeticTest, CayleyTables_MatchPlusOneWalk) {
+    // * таблица сложения должна совпадать с b-кратным применением "+1"
+    for (int i = 0; i < size_; ++i) {
+        for (int j = 0; j < size_; ++j) {
+            char walked = symbols_[i];
+            for (int k = 0; k < j; ++k) {
+                walked = small_->plusOne(walked);
+            }
+            EXPECT_EQ(small_->add(symbols_[i], symbols_[j]), walked)
+                << "Add table mismatch: " << symbols_[i] << "+" << symbols_[j];
+            EXPECT_EQ(small_->addIndex(i, j), rules_->getCharValue(walked));
+        }
+    }
+    std::cout << "    Cayley tables match plus-one walk" << std::endl;
+}
+
+TEST_F(SmallRingArithmeticTest, CarryTables_MatchRingOrder) {
+    const auto& carry = rules_->getCarryTable();
+    const auto& borrow = rules_->getBorrowTable();
+    for (int c = 0; c <= 1; ++c) {
+        for (int a = 0; a < size_; ++a) {
+            for (int b = 0; b < size_; ++b) {
+                size_t cell = (static_cast<size_t>(c) * size_ + a) * size_ + b;
+
+                // цифра суммы совпадает с таблицей Кэли, перенос - по порядку кольца
+                EXPECT_EQ(carry[cell] & 0xFF, small_->addIndex(small_->addIndex(a, b), c));
+                EXPECT_EQ(carry[cell] >> 8, (a + b + c >= size_) ? 1 : 0);
+
+                EXPECT_EQ(borrow[cell] & 0xFF, small_->subtractIndex(small_->subtractIndex(a, b), c));
+                EXPECT_EQ(borrow[cell] >> 8, (a < b + c) ? 1 : 0);
+            }
+        }
+    }
+    std::cout << "    Carry/borrow tables follow ring order" << std::endl;
+}
+
+TEST_F(SmallRingArithmeticTest, Batch_MatchesScalar) {
+    // * Z8 (variant_1) и Z11 (D1), длина не кратна ширине регистра
+    FiniteRingRules z11("../config.yaml", "D1");
+    SmallRingArithmetic small_z11(z11);
+    std::mt19937 gen(1);
+
+    for (const SmallRingArithmetic* ring : {small_.get(), &small_z11}) {
+        const int n = ring->getRules().getSize();
+        const size_t count = 1000 + 37;
+        std::uniform_int_distribution<int> digit(0, n - 1);
+        std::vector<uint8_t> a(count), b(count), out(count);
+        for (size_t i = 0; i < count; ++i) {
+            a[i] = static_cast<uint8_t>(digit(gen));
+            b[i] = static_cast<uint8_t>(digit(gen));
+        }
+
+        ring->addMany(a.data(), b.data(), out.data(), count);
+        for (size_t i = 0; i < count; ++i) EXPECT_EQ(out[i], ring->addIndex(a[i], b[i]));
+        ring->subMany(a.data(), b.data(), out.data(), count);
+        for (size_t i = 0; i < count; ++i) EXPECT_EQ(out[i], ring->subtractIndex(a[i], b[i]));
+        ring->mulMany(a.data(), b.data(), out.data(), count);
+        for (size_t i = 0; i < count; ++i) EXPECT_EQ(out[i], ring->multiplyIndex(a[i], b[i]));
+
+        // обратные: только по обратимым элементам, иначе ожидаем исключение
+        const auto& inv = ring->getRules().getInvTable();
+        std::vector<uint8_t> invertible;
+        for (int x = 0; x < n; ++x) {
+            if (inv[x] != FiniteRingRules::NO_INVERSE) invertible.push_back(static_cast<uint8_t>(x));
+        }
+        std::vector<uint8_t> units(count);
+        for (size_t i = 0; i < count; ++i) units[i] = invertible[gen() % invertible.size()];
+        ring->invMany(units.data(), out.data(), count);
+        for (size_t i = 0; i < count; ++i) EXPECT_EQ(ring->multiplyIndex(units[i], out[i]), 1);
+        units[count - 1] = 0;
+        EXPECT_THROW(ring->invMany(units.data(), out.data(), count), std::runtime_error);
+
+        // на месте (out == a): ошибка называет исходный элемент, массив не тронут
+        std::vector<uint8_t> in_place(units.begin(), units.end() - 1);
+        ring->invMany(in_place.data(), in_place.data(), in_place.size());
+        for (size_t i = 0; i < in_place.size(); ++i) EXPECT_EQ(ring->multiplyIndex(units[i], in_place[i]), 1);
+        try {
+            ring->invMany(units.data(), units.data(), count);
+            ADD_FAILURE() << "zero inverted in place";
+        } catch (const std::runtime_error& e) {
+            EXPECT_STREQ(e.what(), "Zero has no multiplicative inverse");
+        }
+        for (int x = 1; x < n; ++x) {
+            if (inv[x] != FiniteRingRules::NO_INVERSE) continue;
+            units[count - 1] = static_cast<uint8_t>(x);
+            try {
+                ring->invMany(units.data(), units.data(), count);
+                ADD_FAILURE() << "zero divisor inverted in place";
+            } catch (const std::runtime_error& e) {
+                EXPECT_EQ(std::string(e.what()), std::string("No multiplicative inverse for element: ") +
+                                                     ring->getRules().getValueChar(x));
+            }
+            EXPECT_EQ(units[count - 1], x);
+        }
+
+        a[5] = static_cast<uint8_t>(n);
+        EXPECT_THROW(ring->addMany(a.data(), b.data(), out.data(), count), std::runtime_error);
+    }
+    std::cout << "    Batch kernels (" << SmallRingArithmetic::batchKernelName()
+              << ") match scalar tables" << std::endl;
+}
+
 // int main(int argc, char** argv) {
 //     ::testing::InitGoogleTest(&argc, argv);
     
@@ -292,3 +400,127 @@ TEST_F(SmallRingArithmeticTest, PlusOne_Rule) {
 
 //     return result;
 // }
+
+// * --- РЕЕСТР ВАРИАНТОВ
+TEST_F(SmallRingArithmeticTest, Registry_LoadsEveryVariantOnce) {
+    const RingRegistry& registry = RingRegistry::instance("../config.yaml");
+    EXPECT_EQ(&registry, &RingRegistry::instance("../config.yaml"));
+    ASSERT_TRUE(registry.contains("variant_1"));
+    EXPECT_EQ(registry.getGroup("variant_1"), "Z8");
+
+    // каждый вариант из кэша совпадает с загруженным напрямую из файла
+    for (const std::string& name : registry.getNames()) {
+        FiniteRingRules direct("../config.yaml", name);
+        const FiniteRingRules& cached = registry.rules(name);
+        EXPECT_EQ(cached.getOrderedValues(), direct.getOrderedValues());
+        EXPECT_EQ(cached.getMulTable(), direct.getMulTable());
+        EXPECT_EQ(cached.getInvTable(), direct.getInvTable());
+        EXPECT_EQ(registry.get(name).get(), &cached);
+    }
+
+    // правила из реестра пригодны для арифметики как обычные
+    SmallRingArithmetic cached_small(registry.rules("variant_1"));
+    for (char a : symbols_) {
+        for (char b : symbols_) {
+            EXPECT_EQ(cached_small.multiply(a, b), small_->multiply(a, b));
+        }
+    }
+    EXPECT_THROW(registry.get("no_such_variant"), std::runtime_error);
+    std::cout << "   Registry caches and validates all variants" << std::endl;
+}
+
+TEST_F(SmallRingArithmeticTest, Registry_RejectsInvalidVariant) {
+    const std::string path = "registry_invalid.yaml";
+    {
+        std::ofstream out(path);
+        out << "variants:\n"
+               "  Z3:\n"
+               "    good:\n"
+               "      size: 3\n"
+               "      rule_plus_one: [a, b, c]\n"
+               "      zero_element: a\n"
+               "      one_element: b\n"
+               "    bad:\n"
+               "      size: 3\n"
+               "      rule_plus_one: [a, b]\n"
+               "      zero_element: a\n"
+               "      one_element: b\n";
+    }
+    // ошибка в одном варианте видна сразу при загрузке, а не при первом обращении
+    try {
+        RingRegistry registry(path);
+        FAIL() << "invalid variant accepted";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("Invalid variant 'bad'"), std::string::npos);
+    }
+    std::remove(path.c_str());
+    std::cout << "   Invalid variant rejected at load time" << std::endl;
+}
+
+// * --- ТАБЛИЦЫ ДЛЯ ОТЧЁТОВ ---
+TEST_F(SmallRingArithmeticTest, TableGenerator_MatchesSmallArithmetic) {
+    const RingRegistry& registry = RingRegistry::instance("../config.yaml");
+    for (const std::string& name : registry.getNames()) {
+        const FiniteRingRules& rules = registry.rules(name);
+        SmallRingArithmetic small(rules);
+        TableGenerator generator(rules);
+        const int n = rules.getSize();
+
+        for (int a = 0; a < n; ++a) {
+            for (int b = 0; b < n; ++b) {
+                char ca = rules.getValueChar(a), cb = rules.getValueChar(b);
+                EXPECT_EQ(rules.getValueChar(generator.table(TableKind::Add)[a * n + b]), small.add(ca, cb));
+                EXPECT_EQ(rules.getValueChar(generator.table(TableKind::Multiply)[a * n + b]), small.multiply(ca, cb));
+                EXPECT_EQ(generator.table(TableKind::AddCarry)[a * n + b], (a + b) / n);
+                EXPECT_EQ(generator.table(TableKind::MultiplyCarry)[a * n + b], a * b / n);
+            }
+        }
+    }
+    std::cout << "   Result and carry tables for every variant" << std::endl;
+}
+
+TEST_F(SmallRingArithmeticTest, TableGenerator_Formats) {
+    TableGenerator generator(*rules_);
+    auto lines = [](const std::string& text) {
+        std::vector<std::string> result;
+        std::istringstream in(text);
+        for (std::string line; std::getline(in, line);) {
+            result.push_back(line);
+        }
+        return result;
+    };
+
+    // CSV: заголовок + N строк по N + 1 ячеек
+    std::vector<std::string> csv = lines(generator.render(TableKind::Add, TableFormat::Csv));
+    ASSERT_EQ(csv.size(), static_cast<size_t>(size_ + 1));
+    std::string header = "+";
+    for (char c : symbols_) {
+        header += std::string(",") + c;
+    }
+    EXPECT_EQ(csv[0], header);
+    EXPECT_EQ(csv[2].substr(0, 3), std::string(1, symbols_[1]) + "," + small_->add(symbols_[1], symbols_[0]));
+
+    // Markdown: заголовок, разделитель, N строк
+    std::vector<std::string> md = lines(generator.render(TableKind::Multiply, TableFormat::Markdown));
+    ASSERT_EQ(md.size(), static_cast<size_t>(size_ + 2));
+    std::string separator = "|---|";
+    for (int i = 0; i < size_; ++i) {
+        separator += "---|";
+    }
+    EXPECT_EQ(md[1], separator);
+    EXPECT_EQ(md[2].substr(0, 9), std::string("| **") + symbols_[0] + "** |");
+
+    // LaTeX: tabular с N + 1 столбцами
+    std::string tex = generator.render(TableKind::AddCarry, TableFormat::Latex);
+    EXPECT_EQ(tex.find("\\begin{tabular}{c|" + std::string(size_, 'c') + "}"), 0u);
+    EXPECT_NE(tex.find("\\end{tabular}"), std::string::npos);
+
+    // все таблицы подряд и разбор имени формата
+    std::string all = generator.renderAll(TableFormat::Markdown);
+    for (TableKind kind : TableGenerator::allTables()) {
+        EXPECT_NE(all.find("### " + TableGenerator::tableTitle(kind)), std::string::npos);
+    }
+    EXPECT_EQ(TableGenerator::parseFormat("tex"), TableFormat::Latex);
+    EXPECT_THROW(TableGenerator::parseFormat("xls"), std::runtime_error);
+    std::cout << "   CSV, Markdown and LaTeX tables rendered" << std::endl;
+}
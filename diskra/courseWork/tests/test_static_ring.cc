@@ -0,0 +1,217 @@
+// tests/test_static_ring.cc
+
+#include "gtest/gtest.h"
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "StaticRingArithmetic.h"
+#include "FixedRingNumber.h"
+#include "BigRingArithmetic.h"
+#include "RingVariants.h"
+#include <string>
+#include <memory>
+#include <iostream>
+#include <random>
+
+// * RingList<...> из сгенерированного заголовка -> ::testing::Types<...>
+template <class List>
+struct ToTestingTypes;
+
+template <class... Rings>
+struct ToTestingTypes<rings::RingList<Rings...>> {
+    using type = ::testing::Types<Rings...>;
+};
+
+// свойства любого кольца из конфига проверяются на этапе компиляции
+template <class Ring>
+constexpr bool checkRingAxioms() {
+    using Arith = StaticRingArithmetic<Ring>;
+    for (int a = 0; a < Ring::size; ++a) {
+        uint8_t va = static_cast<uint8_t>(a);
+        if (Arith::addIndex(va, 0) != va || Arith::multiplyIndex(va, 1) != va) {
+            return false;
+        }
+        if (Arith::addIndex(va, Arith::negateIndex(va)) != 0) {
+            return false;
+        }
+    }
+    return Arith::toChar(0) == Ring::zero && Arith::toChar(1) == Ring::one;
+}
+
+template <class List>
+struct AllAxioms;
+
+template <class... Rings>
+struct AllAxioms<rings::RingList<Rings...>> {
+    static constexpr bool value = (checkRingAxioms<Rings>() && ...);
+};
+
+static_assert(AllAxioms<rings::AllRings>::value, "generated ring tables violate ring axioms");
+
+// 8 цифр + знак: Z8 - 27 бит, Z11 - 36 бит
+static_assert(sizeof(FixedRingNumber<rings::Z8_variant_1>) == sizeof(uint32_t), "Z8 number must fit in uint32_t");
+static_assert(sizeof(FixedRingNumber<rings::Z11_D1>) == sizeof(uint64_t), "Z11 number must fit in uint64_t");
+static_assert((FixedRingNumber<rings::Z11_D1>::fromInteger(-5) + FixedRingNumber<rings::Z11_D1>::fromInteger(17)).toInteger() == 12,
+              "fixed-width arithmetic must be usable at compile time");
+
+template <class Ring>
+class StaticRingTest : public ::testing::Test {
+protected:
+    using Arith = StaticRingArithmetic<Ring>;
+
+    void SetUp() override {
+        rules_ = std::make_unique<FiniteRingRules>("../config.yaml", Ring::name);
+        small_ = std::make_unique<SmallRingArithmetic>(*rules_);
+        std::cout << "\n--- Testing static ring " << Ring::group << " / " << Ring::name << " ---" << std::endl;
+    }
+
+    std::unique_ptr<FiniteRingRules> rules_;
+    std::unique_ptr<SmallRingArithmetic> small_;
+};
+
+TYPED_TEST_SUITE(StaticRingTest, typename ToTestingTypes<rings::AllRings>::type);
+
+// * --- ТЕСТ 1: сгенерированные таблицы совпадают с загруженными в рантайме
+TYPED_TEST(StaticRingTest, Tables_MatchRuntimeRules) {
+    using Arith = typename TestFixture::Arith;
+    const FiniteRingRules& rules = *this->rules_;
+    const int n = rules.getSize();
+
+    ASSERT_EQ(TypeParam::size, n);
+    EXPECT_EQ(TypeParam::zero, rules.getZeroElement());
+    EXPECT_EQ(TypeParam::one, rules.getOneElement());
+    EXPECT_EQ(TypeParam::digits_per_limb, rules.getDigitsPerLimb());
+    EXPECT_EQ(TypeParam::limb_base, rules.getLimbBase());
+
+    for (int code = 0; code < 256; ++code) {
+        EXPECT_EQ(TypeParam::index_table[code], rules.getIndexTable()[code]);
+    }
+    for (int a = 0; a < n; ++a) {
+        EXPECT_EQ(Arith::toChar(a), rules.getValueChar(a));
+        EXPECT_EQ(Arith::negateIndex(a), rules.getNegTable()[a]);
+        EXPECT_EQ(Arith::inverseIndex(a), rules.getInvTable()[a]);
+        for (int b = 0; b < n; ++b) {
+            EXPECT_EQ(Arith::addIndex(a, b), rules.getAddTable()[a * n + b]);
+            EXPECT_EQ(Arith::subtractIndex(a, b), rules.getSubTable()[a * n + b]);
+            EXPECT_EQ(Arith::multiplyIndex(a, b), rules.getMulTable()[a * n + b]);
+        }
+    }
+    std::cout << "   Generated tables match runtime rules" << std::endl;
+}
+
+// * --- ТЕСТ 2: операции над символами ведут себя как SmallRingArithmetic
+TYPED_TEST(StaticRingTest, CharOps_MatchSmallArithmetic) {
+    using Arith = typename TestFixture::Arith;
+    const SmallRingArithmetic& small = *this->small_;
+
+    for (char a : TypeParam::symbols) {
+        EXPECT_EQ(Arith::findAdditiveInverse(a), small.findAdditiveInverse(a));
+        for (char b : TypeParam::symbols) {
+            EXPECT_EQ(Arith::add(a, b), small.add(a, b));
+            EXPECT_EQ(Arith::subtract(a, b), small.subtract(a, b));
+            EXPECT_EQ(Arith::multiply(a, b), small.multiply(a, b));
+
+            bool runtime_threw = false;
+            char expected = 0;
+            try {
+                expected = small.divide(a, b);
+            } catch (const std::runtime_error&) {
+                runtime_threw = true;
+            }
+            if (runtime_threw) {
+                EXPECT_THROW(Arith::divide(a, b), std::runtime_error);
+            } else {
+                EXPECT_EQ(Arith::divide(a, b), expected);
+            }
+        }
+    }
+    EXPECT_THROW(Arith::toIndex('#'), std::runtime_error);
+    std::cout << "   Static char operations match SmallRingArithmetic" << std::endl;
+}
+
+// * --- ТЕСТ 3: число в машинном слове считает как int64 (в пределах диапазона)
+TYPED_TEST(StaticRingTest, FixedNumber_MatchesIntegerArithmetic) {
+    using Fixed = FixedRingNumber<TypeParam>;
+    int64_t limit = 1;
+    for (size_t i = 0; i < Fixed::DIGITS; ++i) {
+        limit *= TypeParam::size;
+    }
+
+    std::mt19937_64 gen(21);
+    // |a|, |b| < N^8 / 2: сумма и разность тоже помещаются в 8 цифр
+    std::uniform_int_distribution<int64_t> value(-(limit / 2) + 1, limit / 2 - 1);
+    for (int iter = 0; iter < 20000; ++iter) {
+        const int64_t x = value(gen), y = iter % 7 == 0 ? x : value(gen);
+        const Fixed a = Fixed::fromInteger(x), b = Fixed::fromInteger(y);
+
+        ASSERT_EQ(a.toInteger(), x);
+        EXPECT_EQ(a.isNegative(), x < 0);
+        EXPECT_EQ((a + b).toInteger(), x + y);
+        EXPECT_EQ((a - b).toInteger(), x - y);
+        EXPECT_EQ((-a).toInteger(), -x);
+        EXPECT_EQ(Fixed::compare(a, b), (x > y) - (x < y)) << x << " vs " << y;
+        EXPECT_EQ(a < b, x < y);
+        EXPECT_EQ(a == b, x == y);
+    }
+
+    // границы: весь диапазон 8 цифр со знаком, переполнение заворачивается
+    const Fixed max = Fixed::fromInteger(limit - 1), min = Fixed::fromInteger(-(limit - 1));
+    EXPECT_EQ(max.toInteger(), limit - 1);
+    EXPECT_EQ(min.toInteger(), -(limit - 1));
+    EXPECT_LT(min, max);
+    EXPECT_EQ((max - max).toInteger(), 0);
+    EXPECT_THROW(Fixed::fromInteger(limit), std::runtime_error);
+
+    // наибольшее положительное: старшая цифра ceil(N/2) - 1, остальные N - 1
+    typename Fixed::Word top_bits = 0;
+    for (size_t i = 0; i < Fixed::DIGITS; ++i) {
+        top_bits |= static_cast<typename Fixed::Word>(Fixed::SIZE - 1) << (i * Fixed::WIDTH);
+    }
+    const int64_t top_digit = (Fixed::SIZE + 1) / 2 - 1;
+    top_bits |= static_cast<typename Fixed::Word>(top_digit) << (Fixed::DIGITS * Fixed::WIDTH);
+    const Fixed top = Fixed::fromBits(top_bits);
+    EXPECT_FALSE(top.isNegative());
+    EXPECT_EQ(top.toInteger(), (top_digit + 1) * limit - 1);
+    EXPECT_LE(max, top);
+
+    const Fixed wrapped = top + Fixed::fromInteger(1);
+    EXPECT_TRUE(wrapped.isNegative());
+    EXPECT_LT(wrapped, min);  // самое отрицательное число
+    EXPECT_EQ(wrapped - Fixed::fromInteger(1), top);
+    std::cout << "   Fixed-width add/subtract/compare match int64" << std::endl;
+}
+
+// * --- ТЕСТ 4: перевод в RingNumber и обратно без потерь
+TYPED_TEST(StaticRingTest, FixedNumber_RingNumberRoundTrip) {
+    using Fixed = FixedRingNumber<TypeParam>;
+    const FiniteRingRules& rules = *this->rules_;
+    BigRingArithmetic big(rules, *this->small_);
+
+    std::mt19937 gen(22);
+    std::uniform_int_distribution<int> digit(0, rules.getSize() - 1);
+    for (int iter = 0; iter < 2000; ++iter) {
+        std::vector<uint8_t> digits(1 + gen() % Fixed::DIGITS);
+        for (auto& d : digits) {
+            d = static_cast<uint8_t>(digit(gen));
+        }
+        RingNumber num(rules, digits, gen() % 2 == 0);
+        num.normalize();
+        if (num.isZero()) {
+            num.setNegative(false);
+        }
+
+        const Fixed fixed = Fixed::fromRingNumber(num);
+        ASSERT_EQ(fixed.toRingNumber(rules), num) << num.toString();
+        EXPECT_EQ(fixed.toString(), num.toString());
+
+        // сумма двух чисел до 8 цифр может занять 9-й разряд - он тоже без потерь
+        RingNumber other(rules, digits, gen() % 2 == 0);
+        other.normalize();
+        const Fixed sum = fixed + Fixed::fromRingNumber(other);
+        EXPECT_EQ(sum.toRingNumber(rules), big.add(num, other));
+        EXPECT_EQ((fixed - Fixed::fromRingNumber(other)).toRingNumber(rules), big.subtract(num, other));
+    }
+
+    std::vector<uint8_t> too_long(Fixed::DIGITS + 1, 1);
+    EXPECT_THROW(Fixed::fromRingNumber(RingNumber(rules, too_long)), std::runtime_error);
+    std::cout << "   Fixed-width number round-trips through RingNumber" << std::endl;
+}
@@ -0,0 +1,175 @@
+// tests/test_storage.cc
+// Упакованный двоичный формат: потоковое чтение и доступ по номеру
+
+#include "gtest/gtest.h"
+#include "FiniteRingRules.h"
+#include "RingNumber.h"
+#include "RingStorage.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+class RingStorageTest : public ::testing::TestWithParam<std::string> {
+protected:
+    std::unique_ptr<FiniteRingRules> rules_;
+    std::mt19937 gen_{5};
+    std::string path_;
+
+    void SetUp() override {
+        rules_ = std::make_unique<FiniteRingRules>("../config.yaml", GetParam());
+        path_ = ::testing::TempDir() + "ring_storage_" + GetParam() + ".bin";
+    }
+
+    void TearDown() override {
+        std::remove(path_.c_str());
+    }
+
+    // ноль и числа от 1 до 40 цифр (каждое 97-е - 300), со случайным знаком
+    std::vector<RingNumber> randomNumbers(size_t count) {
+        std::uniform_int_distribution<int> digit(0, rules_->getSize() - 1);
+        std::uniform_int_distribution<size_t> length(1, 40);
+        std::vector<RingNumber> nums;
+        nums.push_back(RingNumber(*rules_));
+        for (size_t i = 1; i < count; ++i) {
+            const size_t len = i % 97 == 0 ? 300 : length(gen_);
+            DigitBuffer values(len);
+            for (size_t d = 0; d < len; ++d) {
+                values[d] = static_cast<uint8_t>(digit(gen_));
+            }
+            nums.emplace_back(*rules_, std::move(values), gen_() % 2 == 0);
+        }
+        return nums;
+    }
+};
+
+TEST_P(RingStorageTest, StreamRoundTrip) {
+    const std::vector<RingNumber> nums = randomNumbers(5000);
+    std::stringstream stream;
+    {
+        RingStorageWriter writer(stream, *rules_, GetParam());
+        writer.writeMany(nums);
+        EXPECT_EQ(writer.count(), nums.size());
+    }
+
+    // цифра занимает w бит вместо байта символа, на запись - байт длины
+    const size_t bits = rules_->getSize() <= 8 ? 3 : 4;
+    size_t chars = 0;
+    size_t packed = 0;
+    for (const RingNumber& num : nums) {
+        chars += num.toString().size();
+        packed += (num.length() * bits + 7) / 8 + 2;
+    }
+    EXPECT_LE(stream.str().size(), packed + 1024);
+    EXPECT_LT(stream.str().size(), chars * 5 / 8);
+
+    RingStorageReader reader(stream, *rules_);
+    EXPECT_EQ(reader.header().variant, GetParam());
+    EXPECT_EQ(reader.header().size, rules_->getSize());
+    const std::vector<RingNumber> first = reader.readMany(1000);
+    ASSERT_EQ(first.size(), 1000u);
+    RingNumber num(*rules_);
+    size_t i = first.size();
+    for (size_t k = 0; k < first.size(); ++k) {
+        EXPECT_EQ(first[k], nums[k]) << k;
+    }
+    while (reader.next(num)) {
+        ASSERT_LT(i, nums.size());
+        EXPECT_EQ(num, nums[i]) << i;
+        ++i;
+    }
+    EXPECT_EQ(i, nums.size());
+    EXPECT_FALSE(reader.next(num));
+    std::cout << "   Storage stream round trip verified" << std::endl;
+}
+
+TEST_P(RingStorageTest, MappedRandomAccess) {
+    const std::vector<RingNumber> nums = randomNumbers(1000);
+    {
+        RingStorageWriter writer(path_, *rules_, GetParam());
+        writer.writeMany(nums);
+        writer.close();
+    }
+
+    MappedRingStorage storage(path_, *rules_);
+    ASSERT_EQ(storage.size(), nums.size());
+    // границы блоков индекса и случайный порядок
+    for (uint64_t index : {0u, 1u, 63u, 64u, 65u, 127u, 128u, 999u}) {
+        EXPECT_EQ(storage.at(index), nums[index]) << index;
+    }
+    std::uniform_int_distribution<uint64_t> pick(0, nums.size() - 1);
+    for (int k = 0; k < 500; ++k) {
+        const uint64_t index = pick(gen_);
+        EXPECT_EQ(storage.at(index), nums[index]) << index;
+    }
+    EXPECT_THROW(storage.at(nums.size()), std::out_of_range);
+    std::cout << "   Storage random access verified" << std::endl;
+}
+
+TEST_P(RingStorageTest, RejectsForeignAndBrokenFiles) {
+    {
+        RingStorageWriter writer(path_, *rules_, GetParam());
+        writer.writeMany(randomNumbers(10));
+    }
+
+    // другой размер кольца или другой алфавит того же размера
+    const std::string other = rules_->getSize() == 8 ? "D1" : "variant_1";
+    const FiniteRingRules foreign("../config.yaml", other);
+    EXPECT_THROW(MappedRingStorage(path_, foreign), std::runtime_error);
+    const FiniteRingRules sibling("../config.yaml", rules_->getSize() == 8 ? "variant_2" : "D9");
+    EXPECT_THROW(RingStorageReader(path_, sibling), std::runtime_error);
+
+    // обрезанный файл: поток упирается в конец, индекса нет
+    std::ifstream in(path_, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    {
+        std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 2));
+    }
+    EXPECT_THROW(MappedRingStorage(path_, *rules_), std::runtime_error);
+    RingStorageReader reader(path_, *rules_);
+    EXPECT_THROW(reader.readMany(100), std::runtime_error);
+
+    std::istringstream garbage("not a ring file at all");
+    EXPECT_THROW(RingStorageReader(garbage, *rules_), std::runtime_error);
+    std::cout << "   Storage validation verified" << std::endl;
+}
+
+TEST_P(RingStorageTest, RejectsTamperedTrailer) {
+    {
+        RingStorageWriter writer(path_, *rules_, GetParam());
+        writer.writeMany(randomNumbers(100));
+    }
+    std::ifstream in(path_, std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+
+    // хвост: число записей u64, смещение индекса u64, метка, резерв
+    auto tamper = [&](size_t field, uint64_t value) {
+        std::string broken = bytes;
+        for (size_t i = 0; i < 8; ++i) {
+            broken[broken.size() - 24 + field * 8 + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+        std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+        out.write(broken.data(), static_cast<std::streamsize>(broken.size()));
+    };
+
+    // индекс за концом файла, за хвостом и слишком много записей
+    tamper(1, bytes.size() + 4096);
+    EXPECT_THROW(MappedRingStorage(path_, *rules_), std::runtime_error);
+    tamper(1, bytes.size() - 8);
+    EXPECT_THROW(MappedRingStorage(path_, *rules_), std::runtime_error);
+    tamper(0, UINT64_MAX);
+    EXPECT_THROW(MappedRingStorage(path_, *rules_), std::runtime_error);
+    tamper(0, 1000);
+    EXPECT_THROW(MappedRingStorage(path_, *rules_), std::runtime_error);
+    std::cout << "   Storage trailer validation verified" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Variants, RingStorageTest, ::testing::Values("variant_1", "D1"));
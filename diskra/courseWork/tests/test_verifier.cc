@@ -0,0 +1,169 @@
+// tests/test_verifier.cc
+// Тесты пула с кражей работы и полного перебора аксиом
+
+#include "gtest/gtest.h"
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "BigRingArithmetic.h"
+#include "AxiomVerifier.h"
+#include "WorkStealingPool.h"
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// * --- ТЕСТ 1: каждый индекс обрабатывается ровно один раз, пул переиспользуется
+TEST(WorkStealingPoolTest, CoversEveryIndexOnce) {
+    WorkStealingPool pool(4);
+    ASSERT_EQ(pool.size(), 4u);
+
+    for (uint64_t count : {1ull, 97ull, 100003ull}) {
+        std::vector<std::atomic<int>> hits(count);
+        std::atomic<bool> aligned{true};
+        std::atomic<uint64_t> sink{0};
+        bool completed = pool.parallelFor(count, 97, [&](uint64_t begin, uint64_t end) {
+            // диапазоны - по grain от нуля, и при краже тоже
+            if (begin % 97 != 0 || end - begin > 97 || (end - begin < 97 && end != count)) {
+                aligned = false;
+            }
+            for (uint64_t i = begin; i < end; ++i) {
+                hits[i].fetch_add(1);
+                // первая четверть дороже: остальные потоки крадут
+                for (uint64_t k = 0; i < count / 4 && k < 200; ++k) {
+                    sink.fetch_add(k, std::memory_order_relaxed);
+                }
+            }
+            return true;
+        });
+        EXPECT_TRUE(completed);
+        EXPECT_TRUE(aligned.load());
+        for (uint64_t i = 0; i < count; ++i) {
+            ASSERT_EQ(hits[i].load(), 1) << "index " << i << " of " << count;
+        }
+    }
+
+    // короткие вызовы подряд: потоки, опоздавшие с прошлого вызова, не теряют новый
+    std::atomic<uint64_t> total{0};
+    uint64_t expected = 0;
+    for (int call = 0; call < 30000; ++call) {
+        const uint64_t count = 1 + call % 37;
+        expected += count;
+        pool.parallelFor(count, 1 + call % 3, [&](uint64_t begin, uint64_t end) {
+            total.fetch_add(end - begin);
+            return true;
+        });
+    }
+    EXPECT_EQ(total.load(), expected);
+    std::cout << "   Every index processed exactly once" << std::endl;
+}
+
+// * --- ТЕСТ 2: ранний выход и исключения из тела
+TEST(WorkStealingPoolTest, EarlyAbortAndErrors) {
+    WorkStealingPool pool(3);
+    std::atomic<uint64_t> processed{0};
+    bool completed = pool.parallelFor(1000000, 100, [&](uint64_t begin, uint64_t end) {
+        processed.fetch_add(end - begin);
+        return !(begin <= 500 && 500 < end);
+    });
+    EXPECT_FALSE(completed);
+    EXPECT_LT(processed.load(), 1000000u);
+
+    // 2^40 индексов: диапазоны делятся лениво, а не раскладываются заранее
+    std::atomic<uint64_t> calls{0};
+    completed = pool.parallelFor(1ull << 40, 64, [&](uint64_t, uint64_t) {
+        return calls.fetch_add(1) < 1000;
+    });
+    EXPECT_FALSE(completed);
+    EXPECT_LT(calls.load(), 100000u);
+
+    EXPECT_THROW(pool.parallelFor(1000, 10, [](uint64_t begin, uint64_t) -> bool {
+        if (begin == 500) {
+            throw std::runtime_error("boom");
+        }
+        return true;
+    }), std::runtime_error);
+
+    // после ошибки пул снова работает
+    EXPECT_TRUE(pool.parallelFor(10, 1, [](uint64_t, uint64_t) { return true; }));
+    std::cout << "   Early abort and exceptions stop the loop" << std::endl;
+}
+
+class AxiomVerifierTest : public ::testing::TestWithParam<const char*> {
+protected:
+    std::unique_ptr<FiniteRingRules> rules_;
+    std::unique_ptr<SmallRingArithmetic> small_;
+    std::unique_ptr<BigRingArithmetic> big_;
+
+    void SetUp() override {
+        rules_ = std::make_unique<FiniteRingRules>("../config.yaml", GetParam());
+        small_ = std::make_unique<SmallRingArithmetic>(*rules_);
+        big_ = std::make_unique<BigRingArithmetic>(*rules_, *small_);
+
+        std::cout << "\n--- Testing AxiomVerifier (" << GetParam() << ") ---" << std::endl;
+    }
+};
+
+// * --- ТЕСТ 3: все аксиомы выполняются на неотрицательных числах до 2 цифр
+TEST_P(AxiomVerifierTest, AllAxiomsHold) {
+    AxiomVerifier verifier(*rules_, *big_);
+    VerifierOptions options;
+    options.max_digits = 2;
+    uint64_t last_done = 0, last_total = 0;
+    options.progress = [&](uint64_t done, uint64_t total) {
+        EXPECT_GE(done, last_done);
+        last_done = done;
+        last_total = total;
+    };
+
+    std::vector<AxiomReport> reports = verifier.run(options);
+    ASSERT_EQ(reports.size(), AxiomVerifier::allAxioms().size());
+
+    const uint64_t space = static_cast<uint64_t>(rules_->getSize()) * rules_->getSize();
+    uint64_t total = 0;
+    for (const AxiomReport& report : reports) {
+        EXPECT_TRUE(report.passed) << AxiomVerifier::axiomName(report.axiom) << ": " << report.message;
+        uint64_t expected = 1;
+        for (int i = 0; i < AxiomVerifier::arity(report.axiom); ++i) {
+            expected *= space;
+        }
+        EXPECT_EQ(report.total, expected);
+        EXPECT_EQ(report.checked, report.total);
+        total += report.total;
+    }
+    EXPECT_EQ(last_done, total);
+    EXPECT_EQ(last_total, total);
+    std::cout << "   All axioms hold for operands up to 2 digits" << std::endl;
+}
+
+// * --- ТЕСТ 4: со знаками деление (-a) / (-b) не даёт a = b*q + r (правило знаков
+// * проекта), перебор останавливается на контрпримере
+TEST_P(AxiomVerifierTest, SignedDivisionCounterexample) {
+    AxiomVerifier verifier(*rules_, *big_);
+    VerifierOptions options;
+    options.max_digits = 1;
+    options.with_signs = true;
+
+    options.axioms = {Axiom::AddAssociative, Axiom::Distributive, Axiom::Identities};
+    for (const AxiomReport& report : verifier.run(options)) {
+        EXPECT_TRUE(report.passed) << AxiomVerifier::axiomName(report.axiom) << ": " << report.message;
+    }
+
+    options.axioms = {Axiom::DivisionInvariant, Axiom::AddCommutative};
+    std::vector<AxiomReport> reports = verifier.run(options);
+    ASSERT_EQ(reports.size(), 1u);  // дальше контрпримера не идём
+    const AxiomReport& report = reports[0];
+    ASSERT_FALSE(report.passed);
+    ASSERT_EQ(report.operands.size(), 2u);
+
+    const RingNumber& a = report.operands[0];
+    const RingNumber& b = report.operands[1];
+    EXPECT_TRUE(a.isNegative());
+    EXPECT_TRUE(b.isNegative());
+    DivisionResult qr = big_->divide(a, b);
+    EXPECT_NE(big_->add(big_->multiply(b, qr.quotient), qr.remainder), a);
+    std::cout << "   Counterexample: " << a.toString() << " / " << b.toString()
+              << " (" << report.message << ")" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Variants, AxiomVerifierTest, ::testing::Values("variant_1", "D1"));
@@ -0,0 +1,148 @@
+// tools/ring_codegen.cc
+// * генератор описателей колец: config.yaml -> заголовок с constexpr-таблицами
+// использование: ring_codegen <config.yaml> <RingVariants.h>
+#include "FiniteRingRules.h"
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace {
+
+struct VariantName {
+    string group;    // Z8, Z11, ...
+    string variant;  // variant_1, D1, ...
+};
+
+// имя структуры: группа + вариант, всё кроме [A-Za-z0-9_] -> '_'
+string identifier(const VariantName& name) {
+    string id = name.group + "_" + name.variant;
+    for (char& c : id) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') {
+            c = '_';
+        }
+    }
+    return id;
+}
+
+// символьный литерал, непечатные и спецсимволы - через \x
+string charLiteral(char c) {
+    unsigned char u = static_cast<unsigned char>(c);
+    if (std::isprint(u) && c != '\'' && c != '\\') {
+        return string("'") + c + "'";
+    }
+    char buf[8];
+    std::snprintf(buf, sizeof(buf), "'\\x%02x'", u);
+    return buf;
+}
+
+template <typename T>
+void writeArray(std::ostream& out, const char* type, const char* name, const vector<T>& values) {
+    out << "    static constexpr " << type << " " << name << "[" << values.size() << "] = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i % 16 == 0) {
+            out << "\n        ";
+        }
+        out << static_cast<long long>(values[i]) << (i + 1 < values.size() ? ", " : "");
+    }
+    out << "\n    };\n";
+}
+
+void writeVariant(std::ostream& out, const VariantName& name, const FiniteRingRules& rules) {
+    const int n = rules.getSize();
+
+    out << "// " << name.group << " / " << name.variant << "\n";
+    out << "struct " << identifier(name) << " {\n";
+    out << "    static constexpr const char* group = \"" << name.group << "\";\n";
+    out << "    static constexpr const char* name = \"" << name.variant << "\";\n";
+    out << "    static constexpr int size = " << n << ";\n";
+    out << "    static constexpr char zero = " << charLiteral(rules.getZeroElement()) << ";\n";
+    out << "    static constexpr char one = " << charLiteral(rules.getOneElement()) << ";\n";
+    out << "    static constexpr int digits_per_limb = " << rules.getDigitsPerLimb() << ";\n";
+    out << "    static constexpr uint64_t limb_base = " << rules.getLimbBase() << "ull;\n";
+
+    out << "    static constexpr char symbols[" << n << "] = {";
+    for (int i = 0; i < n; ++i) {
+        out << charLiteral(rules.getValueChar(i)) << (i + 1 < n ? ", " : "");
+    }
+    out << "};\n";
+
+    const std::array<int16_t, 256>& index = rules.getIndexTable();
+    writeArray(out, "int16_t", "index_table", vector<int16_t>(index.begin(), index.end()));
+    writeArray(out, "uint8_t", "add_table", rules.getAddTable());
+    writeArray(out, "uint8_t", "sub_table", rules.getSubTable());
+    writeArray(out, "uint8_t", "mul_table", rules.getMulTable());
+    writeArray(out, "uint8_t", "neg_table", rules.getNegTable());
+    writeArray(out, "uint8_t", "inv_table", rules.getInvTable());
+    out << "};\n\n";
+}
+
+vector<VariantName> listVariants(const string& config_file) {
+    YAML::Node root = YAML::LoadFile(config_file);
+    if (!root["variants"]) {
+        throw std::runtime_error("Config missing 'variants' section");
+    }
+
+    vector<VariantName> names;
+    for (const auto& type_node : root["variants"]) {
+        for (const auto& var_node : type_node.second) {
+            names.push_back({type_node.first.as<string>(), var_node.first.as<string>()});
+        }
+    }
+    return names;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <config.yaml> <output.h>" << std::endl;
+        return 2;
+    }
+    const string config_file = argv[1];
+    const string output_file = argv[2];
+
+    try {
+        vector<VariantName> names = listVariants(config_file);
+
+        // пишем целиком в память, файл трогаем только после успешной генерации
+        std::ostringstream out;
+        out << "// RingVariants.h - сгенерировано ring_codegen из " << config_file << "\n"
+            << "// ! не редактировать вручную\n"
+            << "#pragma once\n"
+            << "#include <cstdint>\n\n"
+            << "namespace rings {\n\n"
+            << "// * список описателей для перебора в шаблонах\n"
+            << "template <class... Rings>\n"
+            << "struct RingList {};\n\n";
+
+        for (const VariantName& name : names) {
+            // FiniteRingRules проверяет вариант так же, как при загрузке в рантайме
+            FiniteRingRules rules(config_file, name.variant);
+            writeVariant(out, name, rules);
+        }
+
+        out << "using AllRings = RingList<";
+        for (size_t i = 0; i < names.size(); ++i) {
+            out << identifier(names[i]) << (i + 1 < names.size() ? ", " : "");
+        }
+        out << ">;\n\n}  // namespace rings\n";
+
+        std::ofstream file(output_file, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Cannot open output file: " + output_file);
+        }
+        file << out.str();
+    } catch (const std::exception& e) {
+        std::cerr << "ring_codegen: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+// tools/ring_verify.cc
+// * полный перебор аксиом кольца над всеми числами до k цифр
+// использование: ring_verify <config.yaml> <variant> [--digits k] [--threads t]
+//                            [--signed] [--axiom name]...
+// код возврата: 0 - все аксиомы выполнены, 1 - найден контрпример, 2 - ошибка
+#include "FiniteRingRules.h"
+#include "SmallRingArithmetic.h"
+#include "BigRingArithmetic.h"
+#include "AxiomVerifier.h"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using std::string;
+
+namespace {
+
+Axiom parseAxiom(const string& name) {
+    for (Axiom axiom : AxiomVerifier::allAxioms()) {
+        if (AxiomVerifier::axiomName(axiom) == name) {
+            return axiom;
+        }
+    }
+    throw std::runtime_error("Unknown axiom: " + name);
+}
+
+void usage(const char* program) {
+    std::cerr << "usage: " << program << " <config.yaml> <variant> [--digits k] [--threads t]"
+              << " [--signed] [--axiom name]...\n"
+              << "axioms:";
+    for (Axiom axiom : AxiomVerifier::allAxioms()) {
+        std::cerr << " " << AxiomVerifier::axiomName(axiom);
+    }
+    std::cerr << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    try {
+        FiniteRingRules rules(argv[1], argv[2]);
+        SmallRingArithmetic small(rules);
+        BigRingArithmetic big(rules, small);
+
+        VerifierOptions options;
+        for (int i = 3; i < argc; ++i) {
+            const string arg = argv[i];
+            if (arg == "--signed") {
+                options.with_signs = true;
+            } else if (arg == "--digits" && i + 1 < argc) {
+                options.max_digits = std::stoul(argv[++i]);
+            } else if (arg == "--threads" && i + 1 < argc) {
+                options.threads = static_cast<unsigned>(std::stoul(argv[++i]));
+            } else if (arg == "--axiom" && i + 1 < argc) {
+                options.axioms.push_back(parseAxiom(argv[++i]));
+            } else {
+                usage(argv[0]);
+                return 2;
+            }
+        }
+
+        // прогресс - одной строкой в stderr
+        options.progress = [](uint64_t done, uint64_t total) {
+            std::fprintf(stderr, "\r  %llu / %llu (%.1f%%)", static_cast<unsigned long long>(done),
+                         static_cast<unsigned long long>(total), total ? 100.0 * done / total : 100.0);
+        };
+
+        std::cout << "Verifying " << argv[2] << " (N = " << rules.getSize() << "), operands up to "
+                  << options.max_digits << " digits" << (options.with_signs ? ", signed" : "")
+                  << std::endl;
+
+        const auto start = std::chrono::steady_clock::now();
+        AxiomVerifier verifier(rules, big);
+        std::vector<AxiomReport> reports = verifier.run(options);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cerr << std::endl;
+
+        bool passed = true;
+        for (const AxiomReport& report : reports) {
+            std::cout << "  " << AxiomVerifier::axiomName(report.axiom) << ": "
+                      << (report.passed ? "OK" : "FAILED") << " (" << report.checked << " / "
+                      << report.total << ")" << std::endl;
+            if (!report.passed) {
+                passed = false;
+                std::cout << "    counterexample:";
+                for (const RingNumber& operand : report.operands) {
+                    std::cout << " " << operand.toString();
+                }
+                std::cout << "\n    " << report.message << std::endl;
+            }
+        }
+        std::cout << (passed ? "All axioms hold" : "Counterexample found") << " in " << seconds
+                  << " s" << std::endl;
+        return passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "ring_verify: " << e.what() << std::endl;
+        return 2;
+    }
+}